@@ -0,0 +1,346 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/.git/HEAD"
+  "/root/repo/.git/refs/heads/master"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "examples/c_example-prefix/tmp/c_example-mkdirs.cmake"
+  "examples/c_maxsat_example-prefix/tmp/c_maxsat_example-mkdirs.cmake"
+  "examples/cpp_example-prefix/tmp/cpp_example-mkdirs.cmake"
+  "examples/userPropagator-prefix/tmp/userPropagator-mkdirs.cmake"
+  "examples/z3_tptp5-prefix/tmp/z3_tptp5-mkdirs.cmake"
+  "/root/repo/cmake/Z3Config.cmake.in"
+  "/root/repo/cmake/check_link_atomic.cmake"
+  "/root/repo/cmake/cmake_uninstall.cmake.in"
+  "/root/repo/cmake/compiler_lto.cmake"
+  "/root/repo/cmake/compiler_warnings.cmake"
+  "/root/repo/cmake/cxx_compiler_flags_overrides.cmake"
+  "/root/repo/cmake/git_utils.cmake"
+  "/root/repo/cmake/target_arch_detect.cmake"
+  "/root/repo/cmake/target_arch_detect.cpp"
+  "/root/repo/cmake/z3_add_component.cmake"
+  "/root/repo/cmake/z3_add_cxx_flag.cmake"
+  "/root/repo/cmake/z3_append_linker_flag_list_to_target.cmake"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/ackermannization/CMakeLists.txt"
+  "/root/repo/src/api/CMakeLists.txt"
+  "/root/repo/src/api/dll/CMakeLists.txt"
+  "/root/repo/src/ast/CMakeLists.txt"
+  "/root/repo/src/ast/converters/CMakeLists.txt"
+  "/root/repo/src/ast/euf/CMakeLists.txt"
+  "/root/repo/src/ast/fpa/CMakeLists.txt"
+  "/root/repo/src/ast/macros/CMakeLists.txt"
+  "/root/repo/src/ast/normal_forms/CMakeLists.txt"
+  "/root/repo/src/ast/pattern/CMakeLists.txt"
+  "/root/repo/src/ast/proofs/CMakeLists.txt"
+  "/root/repo/src/ast/rewriter/CMakeLists.txt"
+  "/root/repo/src/ast/rewriter/bit_blaster/CMakeLists.txt"
+  "/root/repo/src/ast/simplifiers/CMakeLists.txt"
+  "/root/repo/src/ast/sls/CMakeLists.txt"
+  "/root/repo/src/ast/substitution/CMakeLists.txt"
+  "/root/repo/src/cmd_context/CMakeLists.txt"
+  "/root/repo/src/cmd_context/extra_cmds/CMakeLists.txt"
+  "/root/repo/src/math/automata/CMakeLists.txt"
+  "/root/repo/src/math/dd/CMakeLists.txt"
+  "/root/repo/src/math/grobner/CMakeLists.txt"
+  "/root/repo/src/math/hilbert/CMakeLists.txt"
+  "/root/repo/src/math/interval/CMakeLists.txt"
+  "/root/repo/src/math/lp/CMakeLists.txt"
+  "/root/repo/src/math/polynomial/CMakeLists.txt"
+  "/root/repo/src/math/realclosure/CMakeLists.txt"
+  "/root/repo/src/math/simplex/CMakeLists.txt"
+  "/root/repo/src/math/subpaving/CMakeLists.txt"
+  "/root/repo/src/math/subpaving/tactic/CMakeLists.txt"
+  "/root/repo/src/model/CMakeLists.txt"
+  "/root/repo/src/muz/base/CMakeLists.txt"
+  "/root/repo/src/muz/bmc/CMakeLists.txt"
+  "/root/repo/src/muz/clp/CMakeLists.txt"
+  "/root/repo/src/muz/dataflow/CMakeLists.txt"
+  "/root/repo/src/muz/ddnf/CMakeLists.txt"
+  "/root/repo/src/muz/fp/CMakeLists.txt"
+  "/root/repo/src/muz/rel/CMakeLists.txt"
+  "/root/repo/src/muz/spacer/CMakeLists.txt"
+  "/root/repo/src/muz/tab/CMakeLists.txt"
+  "/root/repo/src/muz/transforms/CMakeLists.txt"
+  "/root/repo/src/nlsat/CMakeLists.txt"
+  "/root/repo/src/nlsat/tactic/CMakeLists.txt"
+  "/root/repo/src/opt/CMakeLists.txt"
+  "/root/repo/src/params/CMakeLists.txt"
+  "/root/repo/src/parsers/smt2/CMakeLists.txt"
+  "/root/repo/src/parsers/util/CMakeLists.txt"
+  "/root/repo/src/qe/CMakeLists.txt"
+  "/root/repo/src/qe/lite/CMakeLists.txt"
+  "/root/repo/src/qe/mbp/CMakeLists.txt"
+  "/root/repo/src/sat/CMakeLists.txt"
+  "/root/repo/src/sat/sat_solver/CMakeLists.txt"
+  "/root/repo/src/sat/smt/CMakeLists.txt"
+  "/root/repo/src/sat/tactic/CMakeLists.txt"
+  "/root/repo/src/shell/CMakeLists.txt"
+  "/root/repo/src/smt/CMakeLists.txt"
+  "/root/repo/src/smt/params/CMakeLists.txt"
+  "/root/repo/src/smt/proto_model/CMakeLists.txt"
+  "/root/repo/src/smt/tactic/CMakeLists.txt"
+  "/root/repo/src/solver/CMakeLists.txt"
+  "/root/repo/src/solver/assertions/CMakeLists.txt"
+  "/root/repo/src/tactic/CMakeLists.txt"
+  "/root/repo/src/tactic/aig/CMakeLists.txt"
+  "/root/repo/src/tactic/arith/CMakeLists.txt"
+  "/root/repo/src/tactic/bv/CMakeLists.txt"
+  "/root/repo/src/tactic/core/CMakeLists.txt"
+  "/root/repo/src/tactic/fd_solver/CMakeLists.txt"
+  "/root/repo/src/tactic/fpa/CMakeLists.txt"
+  "/root/repo/src/tactic/portfolio/CMakeLists.txt"
+  "/root/repo/src/tactic/sls/CMakeLists.txt"
+  "/root/repo/src/tactic/smtlogics/CMakeLists.txt"
+  "/root/repo/src/tactic/ufbv/CMakeLists.txt"
+  "/root/repo/src/test/CMakeLists.txt"
+  "/root/repo/src/test/fuzzing/CMakeLists.txt"
+  "/root/repo/src/test/lp/CMakeLists.txt"
+  "/root/repo/src/util/CMakeLists.txt"
+  "/root/repo/src/util/z3_version.h.cmake.in"
+  "/root/repo/z3.pc.cmake.in"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/ExternalProject.cmake"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/RepositoryInfo.txt.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/cfgcmd.txt.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/mkdirs.cmake.in"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython3.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "git_cmake_files/HEAD"
+  "git_cmake_files/master"
+  "cmake_uninstall.cmake"
+  "Z3Config.cmake"
+  "Z3ConfigVersion.cmake"
+  "z3.pc"
+  "cmake/Z3Config.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/util/z3_version.h"
+  "src/util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/math/polynomial/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/math/dd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/math/hilbert/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/math/simplex/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/math/automata/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/math/interval/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/math/realclosure/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/math/subpaving/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ast/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/params/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ast/rewriter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ast/rewriter/bit_blaster/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ast/normal_forms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ast/macros/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/model/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ast/euf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ast/converters/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ast/substitution/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ast/simplifiers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tactic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/qe/mbp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/qe/lite/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/smt/params/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/parsers/util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/math/grobner/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sat/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/nlsat/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tactic/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/math/subpaving/tactic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tactic/aig/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tactic/arith/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/solver/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cmd_context/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cmd_context/extra_cmds/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/parsers/smt2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/solver/assertions/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ast/pattern/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/math/lp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ast/sls/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sat/smt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sat/tactic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/nlsat/tactic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ackermannization/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ast/proofs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ast/fpa/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/smt/proto_model/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/smt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tactic/bv/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/smt/tactic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tactic/sls/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/qe/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/muz/base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/muz/dataflow/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/muz/transforms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/muz/rel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/muz/clp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/muz/tab/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/muz/bmc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/muz/ddnf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/muz/spacer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/muz/fp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tactic/ufbv/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sat/sat_solver/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tactic/smtlogics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tactic/fpa/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tactic/fd_solver/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tactic/portfolio/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/opt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/api/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/api/dll/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/shell/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/test/fuzzing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/test/lp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/c_example-prefix/tmp/c_example-mkdirs.cmake"
+  "examples/c_example-prefix/src/c_example-stamp/c_example-source_dirinfo.txt"
+  "examples/c_example-prefix/tmp/c_example-cfgcmd.txt"
+  "examples/c_maxsat_example-prefix/tmp/c_maxsat_example-mkdirs.cmake"
+  "examples/c_maxsat_example-prefix/src/c_maxsat_example-stamp/c_maxsat_example-source_dirinfo.txt"
+  "examples/c_maxsat_example-prefix/tmp/c_maxsat_example-cfgcmd.txt"
+  "examples/cpp_example-prefix/tmp/cpp_example-mkdirs.cmake"
+  "examples/cpp_example-prefix/src/cpp_example-stamp/cpp_example-source_dirinfo.txt"
+  "examples/cpp_example-prefix/tmp/cpp_example-cfgcmd.txt"
+  "examples/z3_tptp5-prefix/tmp/z3_tptp5-mkdirs.cmake"
+  "examples/z3_tptp5-prefix/src/z3_tptp5-stamp/z3_tptp5-source_dirinfo.txt"
+  "examples/z3_tptp5-prefix/tmp/z3_tptp5-cfgcmd.txt"
+  "examples/userPropagator-prefix/tmp/userPropagator-mkdirs.cmake"
+  "examples/userPropagator-prefix/src/userPropagator-stamp/userPropagator-source_dirinfo.txt"
+  "examples/userPropagator-prefix/tmp/userPropagator-cfgcmd.txt"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "src/CMakeFiles/libz3.dir/DependInfo.cmake"
+  "src/util/CMakeFiles/util.dir/DependInfo.cmake"
+  "src/math/polynomial/CMakeFiles/polynomial.dir/DependInfo.cmake"
+  "src/math/dd/CMakeFiles/dd.dir/DependInfo.cmake"
+  "src/math/hilbert/CMakeFiles/hilbert.dir/DependInfo.cmake"
+  "src/math/simplex/CMakeFiles/simplex.dir/DependInfo.cmake"
+  "src/math/automata/CMakeFiles/automata.dir/DependInfo.cmake"
+  "src/math/interval/CMakeFiles/interval.dir/DependInfo.cmake"
+  "src/math/realclosure/CMakeFiles/realclosure.dir/DependInfo.cmake"
+  "src/math/subpaving/CMakeFiles/subpaving.dir/DependInfo.cmake"
+  "src/ast/CMakeFiles/ast.dir/DependInfo.cmake"
+  "src/params/CMakeFiles/params.dir/DependInfo.cmake"
+  "src/ast/rewriter/CMakeFiles/rewriter.dir/DependInfo.cmake"
+  "src/ast/rewriter/bit_blaster/CMakeFiles/bit_blaster.dir/DependInfo.cmake"
+  "src/ast/normal_forms/CMakeFiles/normal_forms.dir/DependInfo.cmake"
+  "src/ast/macros/CMakeFiles/macros.dir/DependInfo.cmake"
+  "src/model/CMakeFiles/model.dir/DependInfo.cmake"
+  "src/ast/euf/CMakeFiles/euf.dir/DependInfo.cmake"
+  "src/ast/converters/CMakeFiles/converters.dir/DependInfo.cmake"
+  "src/ast/substitution/CMakeFiles/substitution.dir/DependInfo.cmake"
+  "src/ast/simplifiers/CMakeFiles/simplifiers.dir/DependInfo.cmake"
+  "src/tactic/CMakeFiles/tactic.dir/DependInfo.cmake"
+  "src/qe/mbp/CMakeFiles/mbp.dir/DependInfo.cmake"
+  "src/qe/lite/CMakeFiles/qe_lite.dir/DependInfo.cmake"
+  "src/smt/params/CMakeFiles/smt_params.dir/DependInfo.cmake"
+  "src/parsers/util/CMakeFiles/parser_util.dir/DependInfo.cmake"
+  "src/math/grobner/CMakeFiles/grobner.dir/DependInfo.cmake"
+  "src/sat/CMakeFiles/sat.dir/DependInfo.cmake"
+  "src/nlsat/CMakeFiles/nlsat.dir/DependInfo.cmake"
+  "src/tactic/core/CMakeFiles/core_tactics.dir/DependInfo.cmake"
+  "src/math/subpaving/tactic/CMakeFiles/subpaving_tactic.dir/DependInfo.cmake"
+  "src/tactic/aig/CMakeFiles/aig_tactic.dir/DependInfo.cmake"
+  "src/tactic/arith/CMakeFiles/arith_tactics.dir/DependInfo.cmake"
+  "src/solver/CMakeFiles/solver.dir/DependInfo.cmake"
+  "src/cmd_context/CMakeFiles/cmd_context.dir/DependInfo.cmake"
+  "src/cmd_context/extra_cmds/CMakeFiles/extra_cmds.dir/DependInfo.cmake"
+  "src/parsers/smt2/CMakeFiles/smt2parser.dir/DependInfo.cmake"
+  "src/solver/assertions/CMakeFiles/solver_assertions.dir/DependInfo.cmake"
+  "src/ast/pattern/CMakeFiles/pattern.dir/DependInfo.cmake"
+  "src/math/lp/CMakeFiles/lp.dir/DependInfo.cmake"
+  "src/ast/sls/CMakeFiles/ast_sls.dir/DependInfo.cmake"
+  "src/sat/smt/CMakeFiles/sat_smt.dir/DependInfo.cmake"
+  "src/sat/tactic/CMakeFiles/sat_tactic.dir/DependInfo.cmake"
+  "src/nlsat/tactic/CMakeFiles/nlsat_tactic.dir/DependInfo.cmake"
+  "src/ackermannization/CMakeFiles/ackermannization.dir/DependInfo.cmake"
+  "src/ast/proofs/CMakeFiles/proofs.dir/DependInfo.cmake"
+  "src/ast/fpa/CMakeFiles/fpa.dir/DependInfo.cmake"
+  "src/smt/proto_model/CMakeFiles/proto_model.dir/DependInfo.cmake"
+  "src/smt/CMakeFiles/smt.dir/DependInfo.cmake"
+  "src/tactic/bv/CMakeFiles/bv_tactics.dir/DependInfo.cmake"
+  "src/smt/tactic/CMakeFiles/smt_tactic.dir/DependInfo.cmake"
+  "src/tactic/sls/CMakeFiles/sls_tactic.dir/DependInfo.cmake"
+  "src/qe/CMakeFiles/qe.dir/DependInfo.cmake"
+  "src/muz/base/CMakeFiles/muz.dir/DependInfo.cmake"
+  "src/muz/dataflow/CMakeFiles/dataflow.dir/DependInfo.cmake"
+  "src/muz/transforms/CMakeFiles/transforms.dir/DependInfo.cmake"
+  "src/muz/rel/CMakeFiles/rel.dir/DependInfo.cmake"
+  "src/muz/clp/CMakeFiles/clp.dir/DependInfo.cmake"
+  "src/muz/tab/CMakeFiles/tab.dir/DependInfo.cmake"
+  "src/muz/bmc/CMakeFiles/bmc.dir/DependInfo.cmake"
+  "src/muz/ddnf/CMakeFiles/ddnf.dir/DependInfo.cmake"
+  "src/muz/spacer/CMakeFiles/spacer.dir/DependInfo.cmake"
+  "src/muz/fp/CMakeFiles/fp.dir/DependInfo.cmake"
+  "src/tactic/ufbv/CMakeFiles/ufbv_tactic.dir/DependInfo.cmake"
+  "src/sat/sat_solver/CMakeFiles/sat_solver.dir/DependInfo.cmake"
+  "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/DependInfo.cmake"
+  "src/tactic/fpa/CMakeFiles/fpa_tactics.dir/DependInfo.cmake"
+  "src/tactic/fd_solver/CMakeFiles/fd_solver.dir/DependInfo.cmake"
+  "src/tactic/portfolio/CMakeFiles/portfolio.dir/DependInfo.cmake"
+  "src/opt/CMakeFiles/opt.dir/DependInfo.cmake"
+  "src/api/CMakeFiles/api.dir/DependInfo.cmake"
+  "src/api/dll/CMakeFiles/api_dll.dir/DependInfo.cmake"
+  "src/shell/CMakeFiles/shell.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test-z3.dir/DependInfo.cmake"
+  "src/test/fuzzing/CMakeFiles/fuzzing.dir/DependInfo.cmake"
+  "src/test/lp/CMakeFiles/lp_tst.dir/DependInfo.cmake"
+  "examples/CMakeFiles/c_example.dir/DependInfo.cmake"
+  "examples/CMakeFiles/c_maxsat_example.dir/DependInfo.cmake"
+  "examples/CMakeFiles/cpp_example.dir/DependInfo.cmake"
+  "examples/CMakeFiles/z3_tptp5.dir/DependInfo.cmake"
+  "examples/CMakeFiles/userPropagator.dir/DependInfo.cmake"
+  )
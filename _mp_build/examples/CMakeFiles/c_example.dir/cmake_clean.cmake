@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/c_example"
+  "CMakeFiles/c_example-complete"
+  "c_example-prefix/src/c_example-stamp/c_example-build"
+  "c_example-prefix/src/c_example-stamp/c_example-configure"
+  "c_example-prefix/src/c_example-stamp/c_example-download"
+  "c_example-prefix/src/c_example-stamp/c_example-install"
+  "c_example-prefix/src/c_example-stamp/c_example-mkdir"
+  "c_example-prefix/src/c_example-stamp/c_example-patch"
+  "c_example-prefix/src/c_example-stamp/c_example-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/c_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
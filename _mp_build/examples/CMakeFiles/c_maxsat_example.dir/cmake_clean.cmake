@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/c_maxsat_example"
+  "CMakeFiles/c_maxsat_example-complete"
+  "c_maxsat_example-prefix/src/c_maxsat_example-stamp/c_maxsat_example-build"
+  "c_maxsat_example-prefix/src/c_maxsat_example-stamp/c_maxsat_example-configure"
+  "c_maxsat_example-prefix/src/c_maxsat_example-stamp/c_maxsat_example-download"
+  "c_maxsat_example-prefix/src/c_maxsat_example-stamp/c_maxsat_example-install"
+  "c_maxsat_example-prefix/src/c_maxsat_example-stamp/c_maxsat_example-mkdir"
+  "c_maxsat_example-prefix/src/c_maxsat_example-stamp/c_maxsat_example-patch"
+  "c_maxsat_example-prefix/src/c_maxsat_example-stamp/c_maxsat_example-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/c_maxsat_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
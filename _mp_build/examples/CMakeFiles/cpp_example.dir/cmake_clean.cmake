@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cpp_example"
+  "CMakeFiles/cpp_example-complete"
+  "cpp_example-prefix/src/cpp_example-stamp/cpp_example-build"
+  "cpp_example-prefix/src/cpp_example-stamp/cpp_example-configure"
+  "cpp_example-prefix/src/cpp_example-stamp/cpp_example-download"
+  "cpp_example-prefix/src/cpp_example-stamp/cpp_example-install"
+  "cpp_example-prefix/src/cpp_example-stamp/cpp_example-mkdir"
+  "cpp_example-prefix/src/cpp_example-stamp/cpp_example-patch"
+  "cpp_example-prefix/src/cpp_example-stamp/cpp_example-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/cpp_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
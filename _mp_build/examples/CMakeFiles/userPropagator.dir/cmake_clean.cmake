@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/userPropagator"
+  "CMakeFiles/userPropagator-complete"
+  "userPropagator-prefix/src/userPropagator-stamp/userPropagator-build"
+  "userPropagator-prefix/src/userPropagator-stamp/userPropagator-configure"
+  "userPropagator-prefix/src/userPropagator-stamp/userPropagator-download"
+  "userPropagator-prefix/src/userPropagator-stamp/userPropagator-install"
+  "userPropagator-prefix/src/userPropagator-stamp/userPropagator-mkdir"
+  "userPropagator-prefix/src/userPropagator-stamp/userPropagator-patch"
+  "userPropagator-prefix/src/userPropagator-stamp/userPropagator-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/userPropagator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
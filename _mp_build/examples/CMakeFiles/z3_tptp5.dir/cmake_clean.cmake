@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/z3_tptp5"
+  "CMakeFiles/z3_tptp5-complete"
+  "z3_tptp5-prefix/src/z3_tptp5-stamp/z3_tptp5-build"
+  "z3_tptp5-prefix/src/z3_tptp5-stamp/z3_tptp5-configure"
+  "z3_tptp5-prefix/src/z3_tptp5-stamp/z3_tptp5-download"
+  "z3_tptp5-prefix/src/z3_tptp5-stamp/z3_tptp5-install"
+  "z3_tptp5-prefix/src/z3_tptp5-stamp/z3_tptp5-mkdir"
+  "z3_tptp5-prefix/src/z3_tptp5-stamp/z3_tptp5-patch"
+  "z3_tptp5-prefix/src/z3_tptp5-stamp/z3_tptp5-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/z3_tptp5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/examples/userPropagator"
+  "/root/repo/_mp_build/examples/userPropagator_build_dir"
+  "/root/repo/_mp_build/examples/userPropagator-prefix"
+  "/root/repo/_mp_build/examples/userPropagator-prefix/tmp"
+  "/root/repo/_mp_build/examples/userPropagator-prefix/src/userPropagator-stamp"
+  "/root/repo/_mp_build/examples/userPropagator-prefix/src"
+  "/root/repo/_mp_build/examples/userPropagator-prefix/src/userPropagator-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_mp_build/examples/userPropagator-prefix/src/userPropagator-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_mp_build/examples/userPropagator-prefix/src/userPropagator-stamp${cfgdir}") # cfgdir has leading slash
+endif()
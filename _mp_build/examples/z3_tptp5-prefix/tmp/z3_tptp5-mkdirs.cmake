@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/examples/tptp"
+  "/root/repo/_mp_build/examples/tptp_build_dir"
+  "/root/repo/_mp_build/examples/z3_tptp5-prefix"
+  "/root/repo/_mp_build/examples/z3_tptp5-prefix/tmp"
+  "/root/repo/_mp_build/examples/z3_tptp5-prefix/src/z3_tptp5-stamp"
+  "/root/repo/_mp_build/examples/z3_tptp5-prefix/src"
+  "/root/repo/_mp_build/examples/z3_tptp5-prefix/src/z3_tptp5-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_mp_build/examples/z3_tptp5-prefix/src/z3_tptp5-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_mp_build/examples/z3_tptp5-prefix/src/z3_tptp5-stamp${cfgdir}") # cfgdir has leading slash
+endif()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../libz3.pdb"
+  "../libz3.so"
+  "../libz3.so.4.14"
+  "../libz3.so.4.14.1.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libz3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
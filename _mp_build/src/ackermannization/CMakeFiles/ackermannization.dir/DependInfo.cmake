@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ackermannization/ackermannize_bv_model_converter.cpp" "src/ackermannization/CMakeFiles/ackermannization.dir/ackermannize_bv_model_converter.cpp.o" "gcc" "src/ackermannization/CMakeFiles/ackermannization.dir/ackermannize_bv_model_converter.cpp.o.d"
+  "/root/repo/src/ackermannization/ackermannize_bv_tactic.cpp" "src/ackermannization/CMakeFiles/ackermannization.dir/ackermannize_bv_tactic.cpp.o" "gcc" "src/ackermannization/CMakeFiles/ackermannization.dir/ackermannize_bv_tactic.cpp.o.d"
+  "/root/repo/src/ackermannization/ackr_bound_probe.cpp" "src/ackermannization/CMakeFiles/ackermannization.dir/ackr_bound_probe.cpp.o" "gcc" "src/ackermannization/CMakeFiles/ackermannization.dir/ackr_bound_probe.cpp.o.d"
+  "/root/repo/src/ackermannization/ackr_helper.cpp" "src/ackermannization/CMakeFiles/ackermannization.dir/ackr_helper.cpp.o" "gcc" "src/ackermannization/CMakeFiles/ackermannization.dir/ackr_helper.cpp.o.d"
+  "/root/repo/src/ackermannization/ackr_model_converter.cpp" "src/ackermannization/CMakeFiles/ackermannization.dir/ackr_model_converter.cpp.o" "gcc" "src/ackermannization/CMakeFiles/ackermannization.dir/ackr_model_converter.cpp.o.d"
+  "/root/repo/src/ackermannization/lackr.cpp" "src/ackermannization/CMakeFiles/ackermannization.dir/lackr.cpp.o" "gcc" "src/ackermannization/CMakeFiles/ackermannization.dir/lackr.cpp.o.d"
+  "/root/repo/src/ackermannization/lackr_model_constructor.cpp" "src/ackermannization/CMakeFiles/ackermannization.dir/lackr_model_constructor.cpp.o" "gcc" "src/ackermannization/CMakeFiles/ackermannization.dir/lackr_model_constructor.cpp.o.d"
+  "/root/repo/src/ackermannization/lackr_model_converter_lazy.cpp" "src/ackermannization/CMakeFiles/ackermannization.dir/lackr_model_converter_lazy.cpp.o" "gcc" "src/ackermannization/CMakeFiles/ackermannization.dir/lackr_model_converter_lazy.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ackermannization.dir/ackermannize_bv_model_converter.cpp.o"
+  "CMakeFiles/ackermannization.dir/ackermannize_bv_model_converter.cpp.o.d"
+  "CMakeFiles/ackermannization.dir/ackermannize_bv_tactic.cpp.o"
+  "CMakeFiles/ackermannization.dir/ackermannize_bv_tactic.cpp.o.d"
+  "CMakeFiles/ackermannization.dir/ackr_bound_probe.cpp.o"
+  "CMakeFiles/ackermannization.dir/ackr_bound_probe.cpp.o.d"
+  "CMakeFiles/ackermannization.dir/ackr_helper.cpp.o"
+  "CMakeFiles/ackermannization.dir/ackr_helper.cpp.o.d"
+  "CMakeFiles/ackermannization.dir/ackr_model_converter.cpp.o"
+  "CMakeFiles/ackermannization.dir/ackr_model_converter.cpp.o.d"
+  "CMakeFiles/ackermannization.dir/lackr.cpp.o"
+  "CMakeFiles/ackermannization.dir/lackr.cpp.o.d"
+  "CMakeFiles/ackermannization.dir/lackr_model_constructor.cpp.o"
+  "CMakeFiles/ackermannization.dir/lackr_model_constructor.cpp.o.d"
+  "CMakeFiles/ackermannization.dir/lackr_model_converter_lazy.cpp.o"
+  "CMakeFiles/ackermannization.dir/lackr_model_converter_lazy.cpp.o.d"
+  "ackermannization_params.hpp"
+  "ackermannize_bv_tactic_params.hpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ackermannization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,57 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/api/api_algebraic.cpp" "src/api/CMakeFiles/api.dir/api_algebraic.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_algebraic.cpp.o.d"
+  "/root/repo/src/api/api_arith.cpp" "src/api/CMakeFiles/api.dir/api_arith.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_arith.cpp.o.d"
+  "/root/repo/src/api/api_array.cpp" "src/api/CMakeFiles/api.dir/api_array.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_array.cpp.o.d"
+  "/root/repo/src/api/api_ast.cpp" "src/api/CMakeFiles/api.dir/api_ast.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_ast.cpp.o.d"
+  "/root/repo/src/api/api_ast_map.cpp" "src/api/CMakeFiles/api.dir/api_ast_map.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_ast_map.cpp.o.d"
+  "/root/repo/src/api/api_ast_vector.cpp" "src/api/CMakeFiles/api.dir/api_ast_vector.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_ast_vector.cpp.o.d"
+  "/root/repo/src/api/api_bv.cpp" "src/api/CMakeFiles/api.dir/api_bv.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_bv.cpp.o.d"
+  "/root/repo/_mp_build/src/api/api_commands.cpp" "src/api/CMakeFiles/api.dir/api_commands.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_commands.cpp.o.d"
+  "/root/repo/src/api/api_config_params.cpp" "src/api/CMakeFiles/api.dir/api_config_params.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_config_params.cpp.o.d"
+  "/root/repo/src/api/api_context.cpp" "src/api/CMakeFiles/api.dir/api_context.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_context.cpp.o.d"
+  "/root/repo/src/api/api_datalog.cpp" "src/api/CMakeFiles/api.dir/api_datalog.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_datalog.cpp.o.d"
+  "/root/repo/src/api/api_datatype.cpp" "src/api/CMakeFiles/api.dir/api_datatype.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_datatype.cpp.o.d"
+  "/root/repo/src/api/api_fpa.cpp" "src/api/CMakeFiles/api.dir/api_fpa.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_fpa.cpp.o.d"
+  "/root/repo/src/api/api_goal.cpp" "src/api/CMakeFiles/api.dir/api_goal.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_goal.cpp.o.d"
+  "/root/repo/src/api/api_log.cpp" "src/api/CMakeFiles/api.dir/api_log.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_log.cpp.o.d"
+  "/root/repo/_mp_build/src/api/api_log_macros.cpp" "src/api/CMakeFiles/api.dir/api_log_macros.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_log_macros.cpp.o.d"
+  "/root/repo/src/api/api_model.cpp" "src/api/CMakeFiles/api.dir/api_model.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_model.cpp.o.d"
+  "/root/repo/src/api/api_numeral.cpp" "src/api/CMakeFiles/api.dir/api_numeral.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_numeral.cpp.o.d"
+  "/root/repo/src/api/api_opt.cpp" "src/api/CMakeFiles/api.dir/api_opt.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_opt.cpp.o.d"
+  "/root/repo/src/api/api_params.cpp" "src/api/CMakeFiles/api.dir/api_params.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_params.cpp.o.d"
+  "/root/repo/src/api/api_parsers.cpp" "src/api/CMakeFiles/api.dir/api_parsers.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_parsers.cpp.o.d"
+  "/root/repo/src/api/api_pb.cpp" "src/api/CMakeFiles/api.dir/api_pb.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_pb.cpp.o.d"
+  "/root/repo/src/api/api_polynomial.cpp" "src/api/CMakeFiles/api.dir/api_polynomial.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_polynomial.cpp.o.d"
+  "/root/repo/src/api/api_qe.cpp" "src/api/CMakeFiles/api.dir/api_qe.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_qe.cpp.o.d"
+  "/root/repo/src/api/api_quant.cpp" "src/api/CMakeFiles/api.dir/api_quant.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_quant.cpp.o.d"
+  "/root/repo/src/api/api_rcf.cpp" "src/api/CMakeFiles/api.dir/api_rcf.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_rcf.cpp.o.d"
+  "/root/repo/src/api/api_seq.cpp" "src/api/CMakeFiles/api.dir/api_seq.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_seq.cpp.o.d"
+  "/root/repo/src/api/api_solver.cpp" "src/api/CMakeFiles/api.dir/api_solver.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_solver.cpp.o.d"
+  "/root/repo/src/api/api_special_relations.cpp" "src/api/CMakeFiles/api.dir/api_special_relations.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_special_relations.cpp.o.d"
+  "/root/repo/src/api/api_stats.cpp" "src/api/CMakeFiles/api.dir/api_stats.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_stats.cpp.o.d"
+  "/root/repo/src/api/api_tactic.cpp" "src/api/CMakeFiles/api.dir/api_tactic.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/api_tactic.cpp.o.d"
+  "/root/repo/src/api/z3_replayer.cpp" "src/api/CMakeFiles/api.dir/z3_replayer.cpp.o" "gcc" "src/api/CMakeFiles/api.dir/z3_replayer.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_mp_build/src/api/api_log_macros.cpp" "/root/repo/_mp_build/src/api/api_commands.cpp"
+  "/root/repo/_mp_build/src/api/api_log_macros.h" "/root/repo/_mp_build/src/api/api_commands.cpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,74 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/api.dir/api_algebraic.cpp.o"
+  "CMakeFiles/api.dir/api_algebraic.cpp.o.d"
+  "CMakeFiles/api.dir/api_arith.cpp.o"
+  "CMakeFiles/api.dir/api_arith.cpp.o.d"
+  "CMakeFiles/api.dir/api_array.cpp.o"
+  "CMakeFiles/api.dir/api_array.cpp.o.d"
+  "CMakeFiles/api.dir/api_ast.cpp.o"
+  "CMakeFiles/api.dir/api_ast.cpp.o.d"
+  "CMakeFiles/api.dir/api_ast_map.cpp.o"
+  "CMakeFiles/api.dir/api_ast_map.cpp.o.d"
+  "CMakeFiles/api.dir/api_ast_vector.cpp.o"
+  "CMakeFiles/api.dir/api_ast_vector.cpp.o.d"
+  "CMakeFiles/api.dir/api_bv.cpp.o"
+  "CMakeFiles/api.dir/api_bv.cpp.o.d"
+  "CMakeFiles/api.dir/api_commands.cpp.o"
+  "CMakeFiles/api.dir/api_commands.cpp.o.d"
+  "CMakeFiles/api.dir/api_config_params.cpp.o"
+  "CMakeFiles/api.dir/api_config_params.cpp.o.d"
+  "CMakeFiles/api.dir/api_context.cpp.o"
+  "CMakeFiles/api.dir/api_context.cpp.o.d"
+  "CMakeFiles/api.dir/api_datalog.cpp.o"
+  "CMakeFiles/api.dir/api_datalog.cpp.o.d"
+  "CMakeFiles/api.dir/api_datatype.cpp.o"
+  "CMakeFiles/api.dir/api_datatype.cpp.o.d"
+  "CMakeFiles/api.dir/api_fpa.cpp.o"
+  "CMakeFiles/api.dir/api_fpa.cpp.o.d"
+  "CMakeFiles/api.dir/api_goal.cpp.o"
+  "CMakeFiles/api.dir/api_goal.cpp.o.d"
+  "CMakeFiles/api.dir/api_log.cpp.o"
+  "CMakeFiles/api.dir/api_log.cpp.o.d"
+  "CMakeFiles/api.dir/api_log_macros.cpp.o"
+  "CMakeFiles/api.dir/api_log_macros.cpp.o.d"
+  "CMakeFiles/api.dir/api_model.cpp.o"
+  "CMakeFiles/api.dir/api_model.cpp.o.d"
+  "CMakeFiles/api.dir/api_numeral.cpp.o"
+  "CMakeFiles/api.dir/api_numeral.cpp.o.d"
+  "CMakeFiles/api.dir/api_opt.cpp.o"
+  "CMakeFiles/api.dir/api_opt.cpp.o.d"
+  "CMakeFiles/api.dir/api_params.cpp.o"
+  "CMakeFiles/api.dir/api_params.cpp.o.d"
+  "CMakeFiles/api.dir/api_parsers.cpp.o"
+  "CMakeFiles/api.dir/api_parsers.cpp.o.d"
+  "CMakeFiles/api.dir/api_pb.cpp.o"
+  "CMakeFiles/api.dir/api_pb.cpp.o.d"
+  "CMakeFiles/api.dir/api_polynomial.cpp.o"
+  "CMakeFiles/api.dir/api_polynomial.cpp.o.d"
+  "CMakeFiles/api.dir/api_qe.cpp.o"
+  "CMakeFiles/api.dir/api_qe.cpp.o.d"
+  "CMakeFiles/api.dir/api_quant.cpp.o"
+  "CMakeFiles/api.dir/api_quant.cpp.o.d"
+  "CMakeFiles/api.dir/api_rcf.cpp.o"
+  "CMakeFiles/api.dir/api_rcf.cpp.o.d"
+  "CMakeFiles/api.dir/api_seq.cpp.o"
+  "CMakeFiles/api.dir/api_seq.cpp.o.d"
+  "CMakeFiles/api.dir/api_solver.cpp.o"
+  "CMakeFiles/api.dir/api_solver.cpp.o.d"
+  "CMakeFiles/api.dir/api_special_relations.cpp.o"
+  "CMakeFiles/api.dir/api_special_relations.cpp.o.d"
+  "CMakeFiles/api.dir/api_stats.cpp.o"
+  "CMakeFiles/api.dir/api_stats.cpp.o.d"
+  "CMakeFiles/api.dir/api_tactic.cpp.o"
+  "CMakeFiles/api.dir/api_tactic.cpp.o.d"
+  "CMakeFiles/api.dir/z3_replayer.cpp.o"
+  "CMakeFiles/api.dir/z3_replayer.cpp.o.d"
+  "api_commands.cpp"
+  "api_log_macros.cpp"
+  "api_log_macros.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/api.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
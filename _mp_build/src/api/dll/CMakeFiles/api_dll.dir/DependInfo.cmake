@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/api/dll/dll.cpp" "src/api/dll/CMakeFiles/api_dll.dir/dll.cpp.o" "gcc" "src/api/dll/CMakeFiles/api_dll.dir/dll.cpp.o.d"
+  "/root/repo/_mp_build/src/api/dll/gparams_register_modules.cpp" "src/api/dll/CMakeFiles/api_dll.dir/gparams_register_modules.cpp.o" "gcc" "src/api/dll/CMakeFiles/api_dll.dir/gparams_register_modules.cpp.o.d"
+  "/root/repo/_mp_build/src/api/dll/install_tactic.cpp" "src/api/dll/CMakeFiles/api_dll.dir/install_tactic.cpp.o" "gcc" "src/api/dll/CMakeFiles/api_dll.dir/install_tactic.cpp.o.d"
+  "/root/repo/_mp_build/src/api/dll/mem_initializer.cpp" "src/api/dll/CMakeFiles/api_dll.dir/mem_initializer.cpp.o" "gcc" "src/api/dll/CMakeFiles/api_dll.dir/mem_initializer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
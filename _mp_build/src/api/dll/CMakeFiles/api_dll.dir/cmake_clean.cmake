@@ -0,0 +1,18 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/api_dll.dir/dll.cpp.o"
+  "CMakeFiles/api_dll.dir/dll.cpp.o.d"
+  "CMakeFiles/api_dll.dir/gparams_register_modules.cpp.o"
+  "CMakeFiles/api_dll.dir/gparams_register_modules.cpp.o.d"
+  "CMakeFiles/api_dll.dir/install_tactic.cpp.o"
+  "CMakeFiles/api_dll.dir/install_tactic.cpp.o.d"
+  "CMakeFiles/api_dll.dir/mem_initializer.cpp.o"
+  "CMakeFiles/api_dll.dir/mem_initializer.cpp.o.d"
+  "gparams_register_modules.cpp"
+  "install_tactic.cpp"
+  "mem_initializer.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/api_dll.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
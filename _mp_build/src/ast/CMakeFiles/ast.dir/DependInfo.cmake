@@ -0,0 +1,69 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ast/act_cache.cpp" "src/ast/CMakeFiles/ast.dir/act_cache.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/act_cache.cpp.o.d"
+  "/root/repo/src/ast/arith_decl_plugin.cpp" "src/ast/CMakeFiles/ast.dir/arith_decl_plugin.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/arith_decl_plugin.cpp.o.d"
+  "/root/repo/src/ast/array_decl_plugin.cpp" "src/ast/CMakeFiles/ast.dir/array_decl_plugin.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/array_decl_plugin.cpp.o.d"
+  "/root/repo/src/ast/array_peq.cpp" "src/ast/CMakeFiles/ast.dir/array_peq.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/array_peq.cpp.o.d"
+  "/root/repo/src/ast/ast.cpp" "src/ast/CMakeFiles/ast.dir/ast.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/ast.cpp.o.d"
+  "/root/repo/src/ast/ast_ll_pp.cpp" "src/ast/CMakeFiles/ast.dir/ast_ll_pp.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/ast_ll_pp.cpp.o.d"
+  "/root/repo/src/ast/ast_lt.cpp" "src/ast/CMakeFiles/ast.dir/ast_lt.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/ast_lt.cpp.o.d"
+  "/root/repo/src/ast/ast_pp_dot.cpp" "src/ast/CMakeFiles/ast.dir/ast_pp_dot.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/ast_pp_dot.cpp.o.d"
+  "/root/repo/src/ast/ast_pp_util.cpp" "src/ast/CMakeFiles/ast.dir/ast_pp_util.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/ast_pp_util.cpp.o.d"
+  "/root/repo/src/ast/ast_printer.cpp" "src/ast/CMakeFiles/ast.dir/ast_printer.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/ast_printer.cpp.o.d"
+  "/root/repo/src/ast/ast_smt2_pp.cpp" "src/ast/CMakeFiles/ast.dir/ast_smt2_pp.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/ast_smt2_pp.cpp.o.d"
+  "/root/repo/src/ast/ast_smt_pp.cpp" "src/ast/CMakeFiles/ast.dir/ast_smt_pp.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/ast_smt_pp.cpp.o.d"
+  "/root/repo/src/ast/ast_translation.cpp" "src/ast/CMakeFiles/ast.dir/ast_translation.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/ast_translation.cpp.o.d"
+  "/root/repo/src/ast/ast_util.cpp" "src/ast/CMakeFiles/ast.dir/ast_util.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/ast_util.cpp.o.d"
+  "/root/repo/src/ast/bv_decl_plugin.cpp" "src/ast/CMakeFiles/ast.dir/bv_decl_plugin.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/bv_decl_plugin.cpp.o.d"
+  "/root/repo/src/ast/char_decl_plugin.cpp" "src/ast/CMakeFiles/ast.dir/char_decl_plugin.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/char_decl_plugin.cpp.o.d"
+  "/root/repo/src/ast/cost_evaluator.cpp" "src/ast/CMakeFiles/ast.dir/cost_evaluator.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/cost_evaluator.cpp.o.d"
+  "/root/repo/src/ast/datatype_decl_plugin.cpp" "src/ast/CMakeFiles/ast.dir/datatype_decl_plugin.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/datatype_decl_plugin.cpp.o.d"
+  "/root/repo/src/ast/decl_collector.cpp" "src/ast/CMakeFiles/ast.dir/decl_collector.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/decl_collector.cpp.o.d"
+  "/root/repo/src/ast/display_dimacs.cpp" "src/ast/CMakeFiles/ast.dir/display_dimacs.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/display_dimacs.cpp.o.d"
+  "/root/repo/src/ast/dl_decl_plugin.cpp" "src/ast/CMakeFiles/ast.dir/dl_decl_plugin.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/dl_decl_plugin.cpp.o.d"
+  "/root/repo/src/ast/expr2polynomial.cpp" "src/ast/CMakeFiles/ast.dir/expr2polynomial.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/expr2polynomial.cpp.o.d"
+  "/root/repo/src/ast/expr2var.cpp" "src/ast/CMakeFiles/ast.dir/expr2var.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/expr2var.cpp.o.d"
+  "/root/repo/src/ast/expr_abstract.cpp" "src/ast/CMakeFiles/ast.dir/expr_abstract.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/expr_abstract.cpp.o.d"
+  "/root/repo/src/ast/expr_functors.cpp" "src/ast/CMakeFiles/ast.dir/expr_functors.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/expr_functors.cpp.o.d"
+  "/root/repo/src/ast/expr_map.cpp" "src/ast/CMakeFiles/ast.dir/expr_map.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/expr_map.cpp.o.d"
+  "/root/repo/src/ast/expr_stat.cpp" "src/ast/CMakeFiles/ast.dir/expr_stat.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/expr_stat.cpp.o.d"
+  "/root/repo/src/ast/expr_substitution.cpp" "src/ast/CMakeFiles/ast.dir/expr_substitution.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/expr_substitution.cpp.o.d"
+  "/root/repo/src/ast/for_each_ast.cpp" "src/ast/CMakeFiles/ast.dir/for_each_ast.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/for_each_ast.cpp.o.d"
+  "/root/repo/src/ast/for_each_expr.cpp" "src/ast/CMakeFiles/ast.dir/for_each_expr.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/for_each_expr.cpp.o.d"
+  "/root/repo/src/ast/format.cpp" "src/ast/CMakeFiles/ast.dir/format.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/format.cpp.o.d"
+  "/root/repo/src/ast/fpa_decl_plugin.cpp" "src/ast/CMakeFiles/ast.dir/fpa_decl_plugin.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/fpa_decl_plugin.cpp.o.d"
+  "/root/repo/src/ast/func_decl_dependencies.cpp" "src/ast/CMakeFiles/ast.dir/func_decl_dependencies.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/func_decl_dependencies.cpp.o.d"
+  "/root/repo/src/ast/has_free_vars.cpp" "src/ast/CMakeFiles/ast.dir/has_free_vars.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/has_free_vars.cpp.o.d"
+  "/root/repo/src/ast/macro_substitution.cpp" "src/ast/CMakeFiles/ast.dir/macro_substitution.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/macro_substitution.cpp.o.d"
+  "/root/repo/src/ast/num_occurs.cpp" "src/ast/CMakeFiles/ast.dir/num_occurs.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/num_occurs.cpp.o.d"
+  "/root/repo/src/ast/occurs.cpp" "src/ast/CMakeFiles/ast.dir/occurs.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/occurs.cpp.o.d"
+  "/root/repo/src/ast/pb_decl_plugin.cpp" "src/ast/CMakeFiles/ast.dir/pb_decl_plugin.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/pb_decl_plugin.cpp.o.d"
+  "/root/repo/src/ast/polymorphism_inst.cpp" "src/ast/CMakeFiles/ast.dir/polymorphism_inst.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/polymorphism_inst.cpp.o.d"
+  "/root/repo/src/ast/polymorphism_util.cpp" "src/ast/CMakeFiles/ast.dir/polymorphism_util.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/polymorphism_util.cpp.o.d"
+  "/root/repo/src/ast/pp.cpp" "src/ast/CMakeFiles/ast.dir/pp.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/pp.cpp.o.d"
+  "/root/repo/src/ast/quantifier_stat.cpp" "src/ast/CMakeFiles/ast.dir/quantifier_stat.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/quantifier_stat.cpp.o.d"
+  "/root/repo/src/ast/recfun_decl_plugin.cpp" "src/ast/CMakeFiles/ast.dir/recfun_decl_plugin.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/recfun_decl_plugin.cpp.o.d"
+  "/root/repo/src/ast/reg_decl_plugins.cpp" "src/ast/CMakeFiles/ast.dir/reg_decl_plugins.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/reg_decl_plugins.cpp.o.d"
+  "/root/repo/src/ast/seq_decl_plugin.cpp" "src/ast/CMakeFiles/ast.dir/seq_decl_plugin.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/seq_decl_plugin.cpp.o.d"
+  "/root/repo/src/ast/shared_occs.cpp" "src/ast/CMakeFiles/ast.dir/shared_occs.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/shared_occs.cpp.o.d"
+  "/root/repo/src/ast/special_relations_decl_plugin.cpp" "src/ast/CMakeFiles/ast.dir/special_relations_decl_plugin.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/special_relations_decl_plugin.cpp.o.d"
+  "/root/repo/src/ast/static_features.cpp" "src/ast/CMakeFiles/ast.dir/static_features.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/static_features.cpp.o.d"
+  "/root/repo/src/ast/used_vars.cpp" "src/ast/CMakeFiles/ast.dir/used_vars.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/used_vars.cpp.o.d"
+  "/root/repo/src/ast/value_generator.cpp" "src/ast/CMakeFiles/ast.dir/value_generator.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/value_generator.cpp.o.d"
+  "/root/repo/src/ast/well_sorted.cpp" "src/ast/CMakeFiles/ast.dir/well_sorted.cpp.o" "gcc" "src/ast/CMakeFiles/ast.dir/well_sorted.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,110 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ast.dir/act_cache.cpp.o"
+  "CMakeFiles/ast.dir/act_cache.cpp.o.d"
+  "CMakeFiles/ast.dir/arith_decl_plugin.cpp.o"
+  "CMakeFiles/ast.dir/arith_decl_plugin.cpp.o.d"
+  "CMakeFiles/ast.dir/array_decl_plugin.cpp.o"
+  "CMakeFiles/ast.dir/array_decl_plugin.cpp.o.d"
+  "CMakeFiles/ast.dir/array_peq.cpp.o"
+  "CMakeFiles/ast.dir/array_peq.cpp.o.d"
+  "CMakeFiles/ast.dir/ast.cpp.o"
+  "CMakeFiles/ast.dir/ast.cpp.o.d"
+  "CMakeFiles/ast.dir/ast_ll_pp.cpp.o"
+  "CMakeFiles/ast.dir/ast_ll_pp.cpp.o.d"
+  "CMakeFiles/ast.dir/ast_lt.cpp.o"
+  "CMakeFiles/ast.dir/ast_lt.cpp.o.d"
+  "CMakeFiles/ast.dir/ast_pp_dot.cpp.o"
+  "CMakeFiles/ast.dir/ast_pp_dot.cpp.o.d"
+  "CMakeFiles/ast.dir/ast_pp_util.cpp.o"
+  "CMakeFiles/ast.dir/ast_pp_util.cpp.o.d"
+  "CMakeFiles/ast.dir/ast_printer.cpp.o"
+  "CMakeFiles/ast.dir/ast_printer.cpp.o.d"
+  "CMakeFiles/ast.dir/ast_smt2_pp.cpp.o"
+  "CMakeFiles/ast.dir/ast_smt2_pp.cpp.o.d"
+  "CMakeFiles/ast.dir/ast_smt_pp.cpp.o"
+  "CMakeFiles/ast.dir/ast_smt_pp.cpp.o.d"
+  "CMakeFiles/ast.dir/ast_translation.cpp.o"
+  "CMakeFiles/ast.dir/ast_translation.cpp.o.d"
+  "CMakeFiles/ast.dir/ast_util.cpp.o"
+  "CMakeFiles/ast.dir/ast_util.cpp.o.d"
+  "CMakeFiles/ast.dir/bv_decl_plugin.cpp.o"
+  "CMakeFiles/ast.dir/bv_decl_plugin.cpp.o.d"
+  "CMakeFiles/ast.dir/char_decl_plugin.cpp.o"
+  "CMakeFiles/ast.dir/char_decl_plugin.cpp.o.d"
+  "CMakeFiles/ast.dir/cost_evaluator.cpp.o"
+  "CMakeFiles/ast.dir/cost_evaluator.cpp.o.d"
+  "CMakeFiles/ast.dir/datatype_decl_plugin.cpp.o"
+  "CMakeFiles/ast.dir/datatype_decl_plugin.cpp.o.d"
+  "CMakeFiles/ast.dir/decl_collector.cpp.o"
+  "CMakeFiles/ast.dir/decl_collector.cpp.o.d"
+  "CMakeFiles/ast.dir/display_dimacs.cpp.o"
+  "CMakeFiles/ast.dir/display_dimacs.cpp.o.d"
+  "CMakeFiles/ast.dir/dl_decl_plugin.cpp.o"
+  "CMakeFiles/ast.dir/dl_decl_plugin.cpp.o.d"
+  "CMakeFiles/ast.dir/expr2polynomial.cpp.o"
+  "CMakeFiles/ast.dir/expr2polynomial.cpp.o.d"
+  "CMakeFiles/ast.dir/expr2var.cpp.o"
+  "CMakeFiles/ast.dir/expr2var.cpp.o.d"
+  "CMakeFiles/ast.dir/expr_abstract.cpp.o"
+  "CMakeFiles/ast.dir/expr_abstract.cpp.o.d"
+  "CMakeFiles/ast.dir/expr_functors.cpp.o"
+  "CMakeFiles/ast.dir/expr_functors.cpp.o.d"
+  "CMakeFiles/ast.dir/expr_map.cpp.o"
+  "CMakeFiles/ast.dir/expr_map.cpp.o.d"
+  "CMakeFiles/ast.dir/expr_stat.cpp.o"
+  "CMakeFiles/ast.dir/expr_stat.cpp.o.d"
+  "CMakeFiles/ast.dir/expr_substitution.cpp.o"
+  "CMakeFiles/ast.dir/expr_substitution.cpp.o.d"
+  "CMakeFiles/ast.dir/for_each_ast.cpp.o"
+  "CMakeFiles/ast.dir/for_each_ast.cpp.o.d"
+  "CMakeFiles/ast.dir/for_each_expr.cpp.o"
+  "CMakeFiles/ast.dir/for_each_expr.cpp.o.d"
+  "CMakeFiles/ast.dir/format.cpp.o"
+  "CMakeFiles/ast.dir/format.cpp.o.d"
+  "CMakeFiles/ast.dir/fpa_decl_plugin.cpp.o"
+  "CMakeFiles/ast.dir/fpa_decl_plugin.cpp.o.d"
+  "CMakeFiles/ast.dir/func_decl_dependencies.cpp.o"
+  "CMakeFiles/ast.dir/func_decl_dependencies.cpp.o.d"
+  "CMakeFiles/ast.dir/has_free_vars.cpp.o"
+  "CMakeFiles/ast.dir/has_free_vars.cpp.o.d"
+  "CMakeFiles/ast.dir/macro_substitution.cpp.o"
+  "CMakeFiles/ast.dir/macro_substitution.cpp.o.d"
+  "CMakeFiles/ast.dir/num_occurs.cpp.o"
+  "CMakeFiles/ast.dir/num_occurs.cpp.o.d"
+  "CMakeFiles/ast.dir/occurs.cpp.o"
+  "CMakeFiles/ast.dir/occurs.cpp.o.d"
+  "CMakeFiles/ast.dir/pb_decl_plugin.cpp.o"
+  "CMakeFiles/ast.dir/pb_decl_plugin.cpp.o.d"
+  "CMakeFiles/ast.dir/polymorphism_inst.cpp.o"
+  "CMakeFiles/ast.dir/polymorphism_inst.cpp.o.d"
+  "CMakeFiles/ast.dir/polymorphism_util.cpp.o"
+  "CMakeFiles/ast.dir/polymorphism_util.cpp.o.d"
+  "CMakeFiles/ast.dir/pp.cpp.o"
+  "CMakeFiles/ast.dir/pp.cpp.o.d"
+  "CMakeFiles/ast.dir/quantifier_stat.cpp.o"
+  "CMakeFiles/ast.dir/quantifier_stat.cpp.o.d"
+  "CMakeFiles/ast.dir/recfun_decl_plugin.cpp.o"
+  "CMakeFiles/ast.dir/recfun_decl_plugin.cpp.o.d"
+  "CMakeFiles/ast.dir/reg_decl_plugins.cpp.o"
+  "CMakeFiles/ast.dir/reg_decl_plugins.cpp.o.d"
+  "CMakeFiles/ast.dir/seq_decl_plugin.cpp.o"
+  "CMakeFiles/ast.dir/seq_decl_plugin.cpp.o.d"
+  "CMakeFiles/ast.dir/shared_occs.cpp.o"
+  "CMakeFiles/ast.dir/shared_occs.cpp.o.d"
+  "CMakeFiles/ast.dir/special_relations_decl_plugin.cpp.o"
+  "CMakeFiles/ast.dir/special_relations_decl_plugin.cpp.o.d"
+  "CMakeFiles/ast.dir/static_features.cpp.o"
+  "CMakeFiles/ast.dir/static_features.cpp.o.d"
+  "CMakeFiles/ast.dir/used_vars.cpp.o"
+  "CMakeFiles/ast.dir/used_vars.cpp.o.d"
+  "CMakeFiles/ast.dir/value_generator.cpp.o"
+  "CMakeFiles/ast.dir/value_generator.cpp.o.d"
+  "CMakeFiles/ast.dir/well_sorted.cpp.o"
+  "CMakeFiles/ast.dir/well_sorted.cpp.o.d"
+  "pp_params.hpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ast/converters/equiv_proof_converter.cpp" "src/ast/converters/CMakeFiles/converters.dir/equiv_proof_converter.cpp.o" "gcc" "src/ast/converters/CMakeFiles/converters.dir/equiv_proof_converter.cpp.o.d"
+  "/root/repo/src/ast/converters/expr_inverter.cpp" "src/ast/converters/CMakeFiles/converters.dir/expr_inverter.cpp.o" "gcc" "src/ast/converters/CMakeFiles/converters.dir/expr_inverter.cpp.o.d"
+  "/root/repo/src/ast/converters/generic_model_converter.cpp" "src/ast/converters/CMakeFiles/converters.dir/generic_model_converter.cpp.o" "gcc" "src/ast/converters/CMakeFiles/converters.dir/generic_model_converter.cpp.o.d"
+  "/root/repo/src/ast/converters/horn_subsume_model_converter.cpp" "src/ast/converters/CMakeFiles/converters.dir/horn_subsume_model_converter.cpp.o" "gcc" "src/ast/converters/CMakeFiles/converters.dir/horn_subsume_model_converter.cpp.o.d"
+  "/root/repo/src/ast/converters/model_converter.cpp" "src/ast/converters/CMakeFiles/converters.dir/model_converter.cpp.o" "gcc" "src/ast/converters/CMakeFiles/converters.dir/model_converter.cpp.o.d"
+  "/root/repo/src/ast/converters/proof_converter.cpp" "src/ast/converters/CMakeFiles/converters.dir/proof_converter.cpp.o" "gcc" "src/ast/converters/CMakeFiles/converters.dir/proof_converter.cpp.o.d"
+  "/root/repo/src/ast/converters/replace_proof_converter.cpp" "src/ast/converters/CMakeFiles/converters.dir/replace_proof_converter.cpp.o" "gcc" "src/ast/converters/CMakeFiles/converters.dir/replace_proof_converter.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
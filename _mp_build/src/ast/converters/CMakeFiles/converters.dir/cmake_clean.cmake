@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/converters.dir/equiv_proof_converter.cpp.o"
+  "CMakeFiles/converters.dir/equiv_proof_converter.cpp.o.d"
+  "CMakeFiles/converters.dir/expr_inverter.cpp.o"
+  "CMakeFiles/converters.dir/expr_inverter.cpp.o.d"
+  "CMakeFiles/converters.dir/generic_model_converter.cpp.o"
+  "CMakeFiles/converters.dir/generic_model_converter.cpp.o.d"
+  "CMakeFiles/converters.dir/horn_subsume_model_converter.cpp.o"
+  "CMakeFiles/converters.dir/horn_subsume_model_converter.cpp.o.d"
+  "CMakeFiles/converters.dir/model_converter.cpp.o"
+  "CMakeFiles/converters.dir/model_converter.cpp.o.d"
+  "CMakeFiles/converters.dir/proof_converter.cpp.o"
+  "CMakeFiles/converters.dir/proof_converter.cpp.o.d"
+  "CMakeFiles/converters.dir/replace_proof_converter.cpp.o"
+  "CMakeFiles/converters.dir/replace_proof_converter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/converters.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
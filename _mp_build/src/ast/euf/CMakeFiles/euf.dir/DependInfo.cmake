@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ast/euf/euf_ac_plugin.cpp" "src/ast/euf/CMakeFiles/euf.dir/euf_ac_plugin.cpp.o" "gcc" "src/ast/euf/CMakeFiles/euf.dir/euf_ac_plugin.cpp.o.d"
+  "/root/repo/src/ast/euf/euf_arith_plugin.cpp" "src/ast/euf/CMakeFiles/euf.dir/euf_arith_plugin.cpp.o" "gcc" "src/ast/euf/CMakeFiles/euf.dir/euf_arith_plugin.cpp.o.d"
+  "/root/repo/src/ast/euf/euf_bv_plugin.cpp" "src/ast/euf/CMakeFiles/euf.dir/euf_bv_plugin.cpp.o" "gcc" "src/ast/euf/CMakeFiles/euf.dir/euf_bv_plugin.cpp.o.d"
+  "/root/repo/src/ast/euf/euf_egraph.cpp" "src/ast/euf/CMakeFiles/euf.dir/euf_egraph.cpp.o" "gcc" "src/ast/euf/CMakeFiles/euf.dir/euf_egraph.cpp.o.d"
+  "/root/repo/src/ast/euf/euf_enode.cpp" "src/ast/euf/CMakeFiles/euf.dir/euf_enode.cpp.o" "gcc" "src/ast/euf/CMakeFiles/euf.dir/euf_enode.cpp.o.d"
+  "/root/repo/src/ast/euf/euf_etable.cpp" "src/ast/euf/CMakeFiles/euf.dir/euf_etable.cpp.o" "gcc" "src/ast/euf/CMakeFiles/euf.dir/euf_etable.cpp.o.d"
+  "/root/repo/src/ast/euf/euf_justification.cpp" "src/ast/euf/CMakeFiles/euf.dir/euf_justification.cpp.o" "gcc" "src/ast/euf/CMakeFiles/euf.dir/euf_justification.cpp.o.d"
+  "/root/repo/src/ast/euf/euf_plugin.cpp" "src/ast/euf/CMakeFiles/euf.dir/euf_plugin.cpp.o" "gcc" "src/ast/euf/CMakeFiles/euf.dir/euf_plugin.cpp.o.d"
+  "/root/repo/src/ast/euf/euf_specrel_plugin.cpp" "src/ast/euf/CMakeFiles/euf.dir/euf_specrel_plugin.cpp.o" "gcc" "src/ast/euf/CMakeFiles/euf.dir/euf_specrel_plugin.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
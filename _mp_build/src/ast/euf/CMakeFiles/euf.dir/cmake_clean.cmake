@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/euf.dir/euf_ac_plugin.cpp.o"
+  "CMakeFiles/euf.dir/euf_ac_plugin.cpp.o.d"
+  "CMakeFiles/euf.dir/euf_arith_plugin.cpp.o"
+  "CMakeFiles/euf.dir/euf_arith_plugin.cpp.o.d"
+  "CMakeFiles/euf.dir/euf_bv_plugin.cpp.o"
+  "CMakeFiles/euf.dir/euf_bv_plugin.cpp.o.d"
+  "CMakeFiles/euf.dir/euf_egraph.cpp.o"
+  "CMakeFiles/euf.dir/euf_egraph.cpp.o.d"
+  "CMakeFiles/euf.dir/euf_enode.cpp.o"
+  "CMakeFiles/euf.dir/euf_enode.cpp.o.d"
+  "CMakeFiles/euf.dir/euf_etable.cpp.o"
+  "CMakeFiles/euf.dir/euf_etable.cpp.o.d"
+  "CMakeFiles/euf.dir/euf_justification.cpp.o"
+  "CMakeFiles/euf.dir/euf_justification.cpp.o.d"
+  "CMakeFiles/euf.dir/euf_plugin.cpp.o"
+  "CMakeFiles/euf.dir/euf_plugin.cpp.o.d"
+  "CMakeFiles/euf.dir/euf_specrel_plugin.cpp.o"
+  "CMakeFiles/euf.dir/euf_specrel_plugin.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/euf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
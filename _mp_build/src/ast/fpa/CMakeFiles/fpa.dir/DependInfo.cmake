@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ast/fpa/bv2fpa_converter.cpp" "src/ast/fpa/CMakeFiles/fpa.dir/bv2fpa_converter.cpp.o" "gcc" "src/ast/fpa/CMakeFiles/fpa.dir/bv2fpa_converter.cpp.o.d"
+  "/root/repo/src/ast/fpa/fpa2bv_converter.cpp" "src/ast/fpa/CMakeFiles/fpa.dir/fpa2bv_converter.cpp.o" "gcc" "src/ast/fpa/CMakeFiles/fpa.dir/fpa2bv_converter.cpp.o.d"
+  "/root/repo/src/ast/fpa/fpa2bv_rewriter.cpp" "src/ast/fpa/CMakeFiles/fpa.dir/fpa2bv_rewriter.cpp.o" "gcc" "src/ast/fpa/CMakeFiles/fpa.dir/fpa2bv_rewriter.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fpa.dir/bv2fpa_converter.cpp.o"
+  "CMakeFiles/fpa.dir/bv2fpa_converter.cpp.o.d"
+  "CMakeFiles/fpa.dir/fpa2bv_converter.cpp.o"
+  "CMakeFiles/fpa.dir/fpa2bv_converter.cpp.o.d"
+  "CMakeFiles/fpa.dir/fpa2bv_rewriter.cpp.o"
+  "CMakeFiles/fpa.dir/fpa2bv_rewriter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fpa.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
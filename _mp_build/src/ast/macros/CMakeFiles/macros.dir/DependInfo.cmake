@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ast/macros/macro_finder.cpp" "src/ast/macros/CMakeFiles/macros.dir/macro_finder.cpp.o" "gcc" "src/ast/macros/CMakeFiles/macros.dir/macro_finder.cpp.o.d"
+  "/root/repo/src/ast/macros/macro_manager.cpp" "src/ast/macros/CMakeFiles/macros.dir/macro_manager.cpp.o" "gcc" "src/ast/macros/CMakeFiles/macros.dir/macro_manager.cpp.o.d"
+  "/root/repo/src/ast/macros/macro_util.cpp" "src/ast/macros/CMakeFiles/macros.dir/macro_util.cpp.o" "gcc" "src/ast/macros/CMakeFiles/macros.dir/macro_util.cpp.o.d"
+  "/root/repo/src/ast/macros/quantifier_macro_info.cpp" "src/ast/macros/CMakeFiles/macros.dir/quantifier_macro_info.cpp.o" "gcc" "src/ast/macros/CMakeFiles/macros.dir/quantifier_macro_info.cpp.o.d"
+  "/root/repo/src/ast/macros/quasi_macros.cpp" "src/ast/macros/CMakeFiles/macros.dir/quasi_macros.cpp.o" "gcc" "src/ast/macros/CMakeFiles/macros.dir/quasi_macros.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/macros.dir/macro_finder.cpp.o"
+  "CMakeFiles/macros.dir/macro_finder.cpp.o.d"
+  "CMakeFiles/macros.dir/macro_manager.cpp.o"
+  "CMakeFiles/macros.dir/macro_manager.cpp.o.d"
+  "CMakeFiles/macros.dir/macro_util.cpp.o"
+  "CMakeFiles/macros.dir/macro_util.cpp.o.d"
+  "CMakeFiles/macros.dir/quantifier_macro_info.cpp.o"
+  "CMakeFiles/macros.dir/quantifier_macro_info.cpp.o.d"
+  "CMakeFiles/macros.dir/quasi_macros.cpp.o"
+  "CMakeFiles/macros.dir/quasi_macros.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/macros.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ast/normal_forms/defined_names.cpp" "src/ast/normal_forms/CMakeFiles/normal_forms.dir/defined_names.cpp.o" "gcc" "src/ast/normal_forms/CMakeFiles/normal_forms.dir/defined_names.cpp.o.d"
+  "/root/repo/src/ast/normal_forms/elim_term_ite.cpp" "src/ast/normal_forms/CMakeFiles/normal_forms.dir/elim_term_ite.cpp.o" "gcc" "src/ast/normal_forms/CMakeFiles/normal_forms.dir/elim_term_ite.cpp.o.d"
+  "/root/repo/src/ast/normal_forms/name_exprs.cpp" "src/ast/normal_forms/CMakeFiles/normal_forms.dir/name_exprs.cpp.o" "gcc" "src/ast/normal_forms/CMakeFiles/normal_forms.dir/name_exprs.cpp.o.d"
+  "/root/repo/src/ast/normal_forms/nnf.cpp" "src/ast/normal_forms/CMakeFiles/normal_forms.dir/nnf.cpp.o" "gcc" "src/ast/normal_forms/CMakeFiles/normal_forms.dir/nnf.cpp.o.d"
+  "/root/repo/src/ast/normal_forms/pull_quant.cpp" "src/ast/normal_forms/CMakeFiles/normal_forms.dir/pull_quant.cpp.o" "gcc" "src/ast/normal_forms/CMakeFiles/normal_forms.dir/pull_quant.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,18 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/normal_forms.dir/defined_names.cpp.o"
+  "CMakeFiles/normal_forms.dir/defined_names.cpp.o.d"
+  "CMakeFiles/normal_forms.dir/elim_term_ite.cpp.o"
+  "CMakeFiles/normal_forms.dir/elim_term_ite.cpp.o.d"
+  "CMakeFiles/normal_forms.dir/name_exprs.cpp.o"
+  "CMakeFiles/normal_forms.dir/name_exprs.cpp.o.d"
+  "CMakeFiles/normal_forms.dir/nnf.cpp.o"
+  "CMakeFiles/normal_forms.dir/nnf.cpp.o.d"
+  "CMakeFiles/normal_forms.dir/pull_quant.cpp.o"
+  "CMakeFiles/normal_forms.dir/pull_quant.cpp.o.d"
+  "nnf_params.hpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/normal_forms.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pattern.dir/expr_pattern_match.cpp.o"
+  "CMakeFiles/pattern.dir/expr_pattern_match.cpp.o.d"
+  "CMakeFiles/pattern.dir/pattern_inference.cpp.o"
+  "CMakeFiles/pattern.dir/pattern_inference.cpp.o.d"
+  "database.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pattern.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
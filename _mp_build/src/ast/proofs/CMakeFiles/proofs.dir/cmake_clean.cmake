@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/proofs.dir/proof_checker.cpp.o"
+  "CMakeFiles/proofs.dir/proof_checker.cpp.o.d"
+  "CMakeFiles/proofs.dir/proof_utils.cpp.o"
+  "CMakeFiles/proofs.dir/proof_utils.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/proofs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,62 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ast/rewriter/arith_rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/arith_rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/arith_rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/array_rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/array_rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/array_rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/ast_counter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/ast_counter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/ast_counter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/bit2int.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/bit2int.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/bit2int.cpp.o.d"
+  "/root/repo/src/ast/rewriter/bool_rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/bool_rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/bool_rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/bv2int_translator.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/bv2int_translator.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/bv2int_translator.cpp.o.d"
+  "/root/repo/src/ast/rewriter/bv_bounds.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/bv_bounds.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/bv_bounds.cpp.o.d"
+  "/root/repo/src/ast/rewriter/bv_elim.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/bv_elim.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/bv_elim.cpp.o.d"
+  "/root/repo/src/ast/rewriter/bv_rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/bv_rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/bv_rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/cached_var_subst.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/cached_var_subst.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/cached_var_subst.cpp.o.d"
+  "/root/repo/src/ast/rewriter/char_rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/char_rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/char_rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/datatype_rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/datatype_rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/datatype_rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/der.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/der.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/der.cpp.o.d"
+  "/root/repo/src/ast/rewriter/distribute_forall.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/distribute_forall.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/distribute_forall.cpp.o.d"
+  "/root/repo/src/ast/rewriter/dl_rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/dl_rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/dl_rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/dom_simplifier.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/dom_simplifier.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/dom_simplifier.cpp.o.d"
+  "/root/repo/src/ast/rewriter/elim_bounds.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/elim_bounds.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/elim_bounds.cpp.o.d"
+  "/root/repo/src/ast/rewriter/enum2bv_rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/enum2bv_rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/enum2bv_rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/expr_replacer.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/expr_replacer.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/expr_replacer.cpp.o.d"
+  "/root/repo/src/ast/rewriter/expr_safe_replace.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/expr_safe_replace.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/expr_safe_replace.cpp.o.d"
+  "/root/repo/src/ast/rewriter/factor_equivs.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/factor_equivs.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/factor_equivs.cpp.o.d"
+  "/root/repo/src/ast/rewriter/factor_rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/factor_rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/factor_rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/fpa_rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/fpa_rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/fpa_rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/func_decl_replace.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/func_decl_replace.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/func_decl_replace.cpp.o.d"
+  "/root/repo/src/ast/rewriter/inj_axiom.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/inj_axiom.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/inj_axiom.cpp.o.d"
+  "/root/repo/src/ast/rewriter/label_rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/label_rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/label_rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/macro_replacer.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/macro_replacer.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/macro_replacer.cpp.o.d"
+  "/root/repo/src/ast/rewriter/maximize_ac_sharing.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/maximize_ac_sharing.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/maximize_ac_sharing.cpp.o.d"
+  "/root/repo/src/ast/rewriter/mk_extract_proc.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/mk_extract_proc.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/mk_extract_proc.cpp.o.d"
+  "/root/repo/src/ast/rewriter/mk_simplified_app.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/mk_simplified_app.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/mk_simplified_app.cpp.o.d"
+  "/root/repo/src/ast/rewriter/pb2bv_rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/pb2bv_rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/pb2bv_rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/pb_rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/pb_rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/pb_rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/push_app_ite.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/push_app_ite.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/push_app_ite.cpp.o.d"
+  "/root/repo/src/ast/rewriter/quant_hoist.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/quant_hoist.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/quant_hoist.cpp.o.d"
+  "/root/repo/src/ast/rewriter/recfun_rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/recfun_rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/recfun_rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/seq_axioms.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/seq_axioms.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/seq_axioms.cpp.o.d"
+  "/root/repo/src/ast/rewriter/seq_dfa.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/seq_dfa.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/seq_dfa.cpp.o.d"
+  "/root/repo/src/ast/rewriter/seq_eq_solver.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/seq_eq_solver.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/seq_eq_solver.cpp.o.d"
+  "/root/repo/src/ast/rewriter/seq_rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/seq_rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/seq_rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/seq_skolem.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/seq_skolem.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/seq_skolem.cpp.o.d"
+  "/root/repo/src/ast/rewriter/th_rewriter.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/th_rewriter.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/th_rewriter.cpp.o.d"
+  "/root/repo/src/ast/rewriter/value_sweep.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/value_sweep.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/value_sweep.cpp.o.d"
+  "/root/repo/src/ast/rewriter/var_subst.cpp" "src/ast/rewriter/CMakeFiles/rewriter.dir/var_subst.cpp.o" "gcc" "src/ast/rewriter/CMakeFiles/rewriter.dir/var_subst.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
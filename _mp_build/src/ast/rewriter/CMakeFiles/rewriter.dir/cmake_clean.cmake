@@ -0,0 +1,95 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rewriter.dir/arith_rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/arith_rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/array_rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/array_rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/ast_counter.cpp.o"
+  "CMakeFiles/rewriter.dir/ast_counter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/bit2int.cpp.o"
+  "CMakeFiles/rewriter.dir/bit2int.cpp.o.d"
+  "CMakeFiles/rewriter.dir/bool_rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/bool_rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/bv2int_translator.cpp.o"
+  "CMakeFiles/rewriter.dir/bv2int_translator.cpp.o.d"
+  "CMakeFiles/rewriter.dir/bv_bounds.cpp.o"
+  "CMakeFiles/rewriter.dir/bv_bounds.cpp.o.d"
+  "CMakeFiles/rewriter.dir/bv_elim.cpp.o"
+  "CMakeFiles/rewriter.dir/bv_elim.cpp.o.d"
+  "CMakeFiles/rewriter.dir/bv_rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/bv_rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/cached_var_subst.cpp.o"
+  "CMakeFiles/rewriter.dir/cached_var_subst.cpp.o.d"
+  "CMakeFiles/rewriter.dir/char_rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/char_rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/datatype_rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/datatype_rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/der.cpp.o"
+  "CMakeFiles/rewriter.dir/der.cpp.o.d"
+  "CMakeFiles/rewriter.dir/distribute_forall.cpp.o"
+  "CMakeFiles/rewriter.dir/distribute_forall.cpp.o.d"
+  "CMakeFiles/rewriter.dir/dl_rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/dl_rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/dom_simplifier.cpp.o"
+  "CMakeFiles/rewriter.dir/dom_simplifier.cpp.o.d"
+  "CMakeFiles/rewriter.dir/elim_bounds.cpp.o"
+  "CMakeFiles/rewriter.dir/elim_bounds.cpp.o.d"
+  "CMakeFiles/rewriter.dir/enum2bv_rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/enum2bv_rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/expr_replacer.cpp.o"
+  "CMakeFiles/rewriter.dir/expr_replacer.cpp.o.d"
+  "CMakeFiles/rewriter.dir/expr_safe_replace.cpp.o"
+  "CMakeFiles/rewriter.dir/expr_safe_replace.cpp.o.d"
+  "CMakeFiles/rewriter.dir/factor_equivs.cpp.o"
+  "CMakeFiles/rewriter.dir/factor_equivs.cpp.o.d"
+  "CMakeFiles/rewriter.dir/factor_rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/factor_rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/fpa_rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/fpa_rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/func_decl_replace.cpp.o"
+  "CMakeFiles/rewriter.dir/func_decl_replace.cpp.o.d"
+  "CMakeFiles/rewriter.dir/inj_axiom.cpp.o"
+  "CMakeFiles/rewriter.dir/inj_axiom.cpp.o.d"
+  "CMakeFiles/rewriter.dir/label_rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/label_rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/macro_replacer.cpp.o"
+  "CMakeFiles/rewriter.dir/macro_replacer.cpp.o.d"
+  "CMakeFiles/rewriter.dir/maximize_ac_sharing.cpp.o"
+  "CMakeFiles/rewriter.dir/maximize_ac_sharing.cpp.o.d"
+  "CMakeFiles/rewriter.dir/mk_extract_proc.cpp.o"
+  "CMakeFiles/rewriter.dir/mk_extract_proc.cpp.o.d"
+  "CMakeFiles/rewriter.dir/mk_simplified_app.cpp.o"
+  "CMakeFiles/rewriter.dir/mk_simplified_app.cpp.o.d"
+  "CMakeFiles/rewriter.dir/pb2bv_rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/pb2bv_rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/pb_rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/pb_rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/push_app_ite.cpp.o"
+  "CMakeFiles/rewriter.dir/push_app_ite.cpp.o.d"
+  "CMakeFiles/rewriter.dir/quant_hoist.cpp.o"
+  "CMakeFiles/rewriter.dir/quant_hoist.cpp.o.d"
+  "CMakeFiles/rewriter.dir/recfun_rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/recfun_rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/seq_axioms.cpp.o"
+  "CMakeFiles/rewriter.dir/seq_axioms.cpp.o.d"
+  "CMakeFiles/rewriter.dir/seq_dfa.cpp.o"
+  "CMakeFiles/rewriter.dir/seq_dfa.cpp.o.d"
+  "CMakeFiles/rewriter.dir/seq_eq_solver.cpp.o"
+  "CMakeFiles/rewriter.dir/seq_eq_solver.cpp.o.d"
+  "CMakeFiles/rewriter.dir/seq_rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/seq_rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/seq_skolem.cpp.o"
+  "CMakeFiles/rewriter.dir/seq_skolem.cpp.o.d"
+  "CMakeFiles/rewriter.dir/th_rewriter.cpp.o"
+  "CMakeFiles/rewriter.dir/th_rewriter.cpp.o.d"
+  "CMakeFiles/rewriter.dir/value_sweep.cpp.o"
+  "CMakeFiles/rewriter.dir/value_sweep.cpp.o.d"
+  "CMakeFiles/rewriter.dir/var_subst.cpp.o"
+  "CMakeFiles/rewriter.dir/var_subst.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rewriter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
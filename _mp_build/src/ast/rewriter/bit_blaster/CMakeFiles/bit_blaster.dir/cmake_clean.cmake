@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bit_blaster.dir/bit_blaster.cpp.o"
+  "CMakeFiles/bit_blaster.dir/bit_blaster.cpp.o.d"
+  "CMakeFiles/bit_blaster.dir/bit_blaster_rewriter.cpp.o"
+  "CMakeFiles/bit_blaster.dir/bit_blaster_rewriter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bit_blaster.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ast/simplifiers/bit_blaster.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/bit_blaster.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/bit_blaster.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/bound_manager.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/bound_manager.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/bound_manager.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/bound_propagator.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/bound_propagator.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/bound_propagator.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/bound_simplifier.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/bound_simplifier.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/bound_simplifier.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/bv_bounds_simplifier.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/bv_bounds_simplifier.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/bv_bounds_simplifier.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/bv_slice.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/bv_slice.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/bv_slice.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/card2bv.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/card2bv.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/card2bv.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/demodulator_simplifier.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/demodulator_simplifier.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/demodulator_simplifier.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/dependent_expr_state.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/dependent_expr_state.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/dependent_expr_state.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/distribute_forall.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/distribute_forall.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/distribute_forall.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/dominator_simplifier.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/dominator_simplifier.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/dominator_simplifier.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/elim_unconstrained.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/elim_unconstrained.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/elim_unconstrained.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/eliminate_predicates.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/eliminate_predicates.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/eliminate_predicates.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/euf_completion.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/euf_completion.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/euf_completion.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/extract_eqs.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/extract_eqs.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/extract_eqs.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/linear_equation.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/linear_equation.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/linear_equation.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/max_bv_sharing.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/max_bv_sharing.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/max_bv_sharing.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/model_reconstruction_trail.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/model_reconstruction_trail.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/model_reconstruction_trail.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/parallel_simplifier.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/parallel_simplifier.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/parallel_simplifier.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/propagate_values.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/propagate_values.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/propagate_values.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/reduce_args_simplifier.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/reduce_args_simplifier.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/reduce_args_simplifier.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/solve_context_eqs.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/solve_context_eqs.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/solve_context_eqs.cpp.o.d"
+  "/root/repo/src/ast/simplifiers/solve_eqs.cpp" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/solve_eqs.cpp.o" "gcc" "src/ast/simplifiers/CMakeFiles/simplifiers.dir/solve_eqs.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
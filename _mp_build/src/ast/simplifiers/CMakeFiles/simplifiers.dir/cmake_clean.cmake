@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simplifiers.dir/bit_blaster.cpp.o"
+  "CMakeFiles/simplifiers.dir/bit_blaster.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/bound_manager.cpp.o"
+  "CMakeFiles/simplifiers.dir/bound_manager.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/bound_propagator.cpp.o"
+  "CMakeFiles/simplifiers.dir/bound_propagator.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/bound_simplifier.cpp.o"
+  "CMakeFiles/simplifiers.dir/bound_simplifier.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/bv_bounds_simplifier.cpp.o"
+  "CMakeFiles/simplifiers.dir/bv_bounds_simplifier.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/bv_slice.cpp.o"
+  "CMakeFiles/simplifiers.dir/bv_slice.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/card2bv.cpp.o"
+  "CMakeFiles/simplifiers.dir/card2bv.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/demodulator_simplifier.cpp.o"
+  "CMakeFiles/simplifiers.dir/demodulator_simplifier.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/dependent_expr_state.cpp.o"
+  "CMakeFiles/simplifiers.dir/dependent_expr_state.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/distribute_forall.cpp.o"
+  "CMakeFiles/simplifiers.dir/distribute_forall.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/dominator_simplifier.cpp.o"
+  "CMakeFiles/simplifiers.dir/dominator_simplifier.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/elim_unconstrained.cpp.o"
+  "CMakeFiles/simplifiers.dir/elim_unconstrained.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/eliminate_predicates.cpp.o"
+  "CMakeFiles/simplifiers.dir/eliminate_predicates.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/euf_completion.cpp.o"
+  "CMakeFiles/simplifiers.dir/euf_completion.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/extract_eqs.cpp.o"
+  "CMakeFiles/simplifiers.dir/extract_eqs.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/linear_equation.cpp.o"
+  "CMakeFiles/simplifiers.dir/linear_equation.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/max_bv_sharing.cpp.o"
+  "CMakeFiles/simplifiers.dir/max_bv_sharing.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/model_reconstruction_trail.cpp.o"
+  "CMakeFiles/simplifiers.dir/model_reconstruction_trail.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/parallel_simplifier.cpp.o"
+  "CMakeFiles/simplifiers.dir/parallel_simplifier.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/propagate_values.cpp.o"
+  "CMakeFiles/simplifiers.dir/propagate_values.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/reduce_args_simplifier.cpp.o"
+  "CMakeFiles/simplifiers.dir/reduce_args_simplifier.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/solve_context_eqs.cpp.o"
+  "CMakeFiles/simplifiers.dir/solve_context_eqs.cpp.o.d"
+  "CMakeFiles/simplifiers.dir/solve_eqs.cpp.o"
+  "CMakeFiles/simplifiers.dir/solve_eqs.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simplifiers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ast/sls/bvsls_opt_engine.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/bvsls_opt_engine.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/bvsls_opt_engine.cpp.o.d"
+  "/root/repo/src/ast/sls/sat_ddfw.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sat_ddfw.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sat_ddfw.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_arith_base.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_arith_base.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_arith_base.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_arith_clausal.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_arith_clausal.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_arith_clausal.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_arith_lookahead.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_arith_lookahead.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_arith_lookahead.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_arith_plugin.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_arith_plugin.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_arith_plugin.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_array_plugin.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_array_plugin.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_array_plugin.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_basic_plugin.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_basic_plugin.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_basic_plugin.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_bv_engine.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_bv_engine.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_bv_engine.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_bv_eval.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_bv_eval.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_bv_eval.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_bv_fixed.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_bv_fixed.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_bv_fixed.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_bv_lookahead.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_bv_lookahead.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_bv_lookahead.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_bv_plugin.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_bv_plugin.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_bv_plugin.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_bv_terms.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_bv_terms.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_bv_terms.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_bv_valuation.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_bv_valuation.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_bv_valuation.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_context.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_context.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_context.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_datatype_plugin.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_datatype_plugin.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_datatype_plugin.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_euf_plugin.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_euf_plugin.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_euf_plugin.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_seq_plugin.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_seq_plugin.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_seq_plugin.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_smt_plugin.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_smt_plugin.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_smt_plugin.cpp.o.d"
+  "/root/repo/src/ast/sls/sls_smt_solver.cpp" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_smt_solver.cpp.o" "gcc" "src/ast/sls/CMakeFiles/ast_sls.dir/sls_smt_solver.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,49 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ast_sls.dir/bvsls_opt_engine.cpp.o"
+  "CMakeFiles/ast_sls.dir/bvsls_opt_engine.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sat_ddfw.cpp.o"
+  "CMakeFiles/ast_sls.dir/sat_ddfw.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_arith_base.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_arith_base.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_arith_clausal.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_arith_clausal.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_arith_lookahead.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_arith_lookahead.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_arith_plugin.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_arith_plugin.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_array_plugin.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_array_plugin.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_basic_plugin.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_basic_plugin.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_bv_engine.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_bv_engine.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_bv_eval.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_bv_eval.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_bv_fixed.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_bv_fixed.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_bv_lookahead.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_bv_lookahead.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_bv_plugin.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_bv_plugin.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_bv_terms.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_bv_terms.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_bv_valuation.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_bv_valuation.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_context.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_context.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_datatype_plugin.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_datatype_plugin.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_euf_plugin.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_euf_plugin.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_seq_plugin.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_seq_plugin.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_smt_plugin.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_smt_plugin.cpp.o.d"
+  "CMakeFiles/ast_sls.dir/sls_smt_solver.cpp.o"
+  "CMakeFiles/ast_sls.dir/sls_smt_solver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ast_sls.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ast/substitution/demodulator_rewriter.cpp" "src/ast/substitution/CMakeFiles/substitution.dir/demodulator_rewriter.cpp.o" "gcc" "src/ast/substitution/CMakeFiles/substitution.dir/demodulator_rewriter.cpp.o.d"
+  "/root/repo/src/ast/substitution/matcher.cpp" "src/ast/substitution/CMakeFiles/substitution.dir/matcher.cpp.o" "gcc" "src/ast/substitution/CMakeFiles/substitution.dir/matcher.cpp.o.d"
+  "/root/repo/src/ast/substitution/substitution.cpp" "src/ast/substitution/CMakeFiles/substitution.dir/substitution.cpp.o" "gcc" "src/ast/substitution/CMakeFiles/substitution.dir/substitution.cpp.o.d"
+  "/root/repo/src/ast/substitution/substitution_tree.cpp" "src/ast/substitution/CMakeFiles/substitution.dir/substitution_tree.cpp.o" "gcc" "src/ast/substitution/CMakeFiles/substitution.dir/substitution_tree.cpp.o.d"
+  "/root/repo/src/ast/substitution/unifier.cpp" "src/ast/substitution/CMakeFiles/substitution.dir/unifier.cpp.o" "gcc" "src/ast/substitution/CMakeFiles/substitution.dir/unifier.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/substitution.dir/demodulator_rewriter.cpp.o"
+  "CMakeFiles/substitution.dir/demodulator_rewriter.cpp.o.d"
+  "CMakeFiles/substitution.dir/matcher.cpp.o"
+  "CMakeFiles/substitution.dir/matcher.cpp.o.d"
+  "CMakeFiles/substitution.dir/substitution.cpp.o"
+  "CMakeFiles/substitution.dir/substitution.cpp.o.d"
+  "CMakeFiles/substitution.dir/substitution_tree.cpp.o"
+  "CMakeFiles/substitution.dir/substitution_tree.cpp.o.d"
+  "CMakeFiles/substitution.dir/unifier.cpp.o"
+  "CMakeFiles/substitution.dir/unifier.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/substitution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
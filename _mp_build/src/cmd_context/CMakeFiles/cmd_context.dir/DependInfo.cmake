@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/cmd_context/basic_cmds.cpp" "src/cmd_context/CMakeFiles/cmd_context.dir/basic_cmds.cpp.o" "gcc" "src/cmd_context/CMakeFiles/cmd_context.dir/basic_cmds.cpp.o.d"
+  "/root/repo/src/cmd_context/cmd_context.cpp" "src/cmd_context/CMakeFiles/cmd_context.dir/cmd_context.cpp.o" "gcc" "src/cmd_context/CMakeFiles/cmd_context.dir/cmd_context.cpp.o.d"
+  "/root/repo/src/cmd_context/cmd_context_to_goal.cpp" "src/cmd_context/CMakeFiles/cmd_context.dir/cmd_context_to_goal.cpp.o" "gcc" "src/cmd_context/CMakeFiles/cmd_context.dir/cmd_context_to_goal.cpp.o.d"
+  "/root/repo/src/cmd_context/cmd_util.cpp" "src/cmd_context/CMakeFiles/cmd_context.dir/cmd_util.cpp.o" "gcc" "src/cmd_context/CMakeFiles/cmd_context.dir/cmd_util.cpp.o.d"
+  "/root/repo/src/cmd_context/echo_tactic.cpp" "src/cmd_context/CMakeFiles/cmd_context.dir/echo_tactic.cpp.o" "gcc" "src/cmd_context/CMakeFiles/cmd_context.dir/echo_tactic.cpp.o.d"
+  "/root/repo/src/cmd_context/eval_cmd.cpp" "src/cmd_context/CMakeFiles/cmd_context.dir/eval_cmd.cpp.o" "gcc" "src/cmd_context/CMakeFiles/cmd_context.dir/eval_cmd.cpp.o.d"
+  "/root/repo/src/cmd_context/parametric_cmd.cpp" "src/cmd_context/CMakeFiles/cmd_context.dir/parametric_cmd.cpp.o" "gcc" "src/cmd_context/CMakeFiles/cmd_context.dir/parametric_cmd.cpp.o.d"
+  "/root/repo/src/cmd_context/pdecl.cpp" "src/cmd_context/CMakeFiles/cmd_context.dir/pdecl.cpp.o" "gcc" "src/cmd_context/CMakeFiles/cmd_context.dir/pdecl.cpp.o.d"
+  "/root/repo/src/cmd_context/simplifier_cmds.cpp" "src/cmd_context/CMakeFiles/cmd_context.dir/simplifier_cmds.cpp.o" "gcc" "src/cmd_context/CMakeFiles/cmd_context.dir/simplifier_cmds.cpp.o.d"
+  "/root/repo/src/cmd_context/simplify_cmd.cpp" "src/cmd_context/CMakeFiles/cmd_context.dir/simplify_cmd.cpp.o" "gcc" "src/cmd_context/CMakeFiles/cmd_context.dir/simplify_cmd.cpp.o.d"
+  "/root/repo/src/cmd_context/tactic_cmds.cpp" "src/cmd_context/CMakeFiles/cmd_context.dir/tactic_cmds.cpp.o" "gcc" "src/cmd_context/CMakeFiles/cmd_context.dir/tactic_cmds.cpp.o.d"
+  "/root/repo/src/cmd_context/tactic_manager.cpp" "src/cmd_context/CMakeFiles/cmd_context.dir/tactic_manager.cpp.o" "gcc" "src/cmd_context/CMakeFiles/cmd_context.dir/tactic_manager.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
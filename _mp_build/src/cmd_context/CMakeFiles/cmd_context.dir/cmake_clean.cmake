@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmd_context.dir/basic_cmds.cpp.o"
+  "CMakeFiles/cmd_context.dir/basic_cmds.cpp.o.d"
+  "CMakeFiles/cmd_context.dir/cmd_context.cpp.o"
+  "CMakeFiles/cmd_context.dir/cmd_context.cpp.o.d"
+  "CMakeFiles/cmd_context.dir/cmd_context_to_goal.cpp.o"
+  "CMakeFiles/cmd_context.dir/cmd_context_to_goal.cpp.o.d"
+  "CMakeFiles/cmd_context.dir/cmd_util.cpp.o"
+  "CMakeFiles/cmd_context.dir/cmd_util.cpp.o.d"
+  "CMakeFiles/cmd_context.dir/echo_tactic.cpp.o"
+  "CMakeFiles/cmd_context.dir/echo_tactic.cpp.o.d"
+  "CMakeFiles/cmd_context.dir/eval_cmd.cpp.o"
+  "CMakeFiles/cmd_context.dir/eval_cmd.cpp.o.d"
+  "CMakeFiles/cmd_context.dir/parametric_cmd.cpp.o"
+  "CMakeFiles/cmd_context.dir/parametric_cmd.cpp.o.d"
+  "CMakeFiles/cmd_context.dir/pdecl.cpp.o"
+  "CMakeFiles/cmd_context.dir/pdecl.cpp.o.d"
+  "CMakeFiles/cmd_context.dir/simplifier_cmds.cpp.o"
+  "CMakeFiles/cmd_context.dir/simplifier_cmds.cpp.o.d"
+  "CMakeFiles/cmd_context.dir/simplify_cmd.cpp.o"
+  "CMakeFiles/cmd_context.dir/simplify_cmd.cpp.o.d"
+  "CMakeFiles/cmd_context.dir/tactic_cmds.cpp.o"
+  "CMakeFiles/cmd_context.dir/tactic_cmds.cpp.o.d"
+  "CMakeFiles/cmd_context.dir/tactic_manager.cpp.o"
+  "CMakeFiles/cmd_context.dir/tactic_manager.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmd_context.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/cmd_context/extra_cmds/dbg_cmds.cpp" "src/cmd_context/extra_cmds/CMakeFiles/extra_cmds.dir/dbg_cmds.cpp.o" "gcc" "src/cmd_context/extra_cmds/CMakeFiles/extra_cmds.dir/dbg_cmds.cpp.o.d"
+  "/root/repo/src/cmd_context/extra_cmds/polynomial_cmds.cpp" "src/cmd_context/extra_cmds/CMakeFiles/extra_cmds.dir/polynomial_cmds.cpp.o" "gcc" "src/cmd_context/extra_cmds/CMakeFiles/extra_cmds.dir/polynomial_cmds.cpp.o.d"
+  "/root/repo/src/cmd_context/extra_cmds/proof_cmds.cpp" "src/cmd_context/extra_cmds/CMakeFiles/extra_cmds.dir/proof_cmds.cpp.o" "gcc" "src/cmd_context/extra_cmds/CMakeFiles/extra_cmds.dir/proof_cmds.cpp.o.d"
+  "/root/repo/src/cmd_context/extra_cmds/subpaving_cmds.cpp" "src/cmd_context/extra_cmds/CMakeFiles/extra_cmds.dir/subpaving_cmds.cpp.o" "gcc" "src/cmd_context/extra_cmds/CMakeFiles/extra_cmds.dir/subpaving_cmds.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/extra_cmds.dir/dbg_cmds.cpp.o"
+  "CMakeFiles/extra_cmds.dir/dbg_cmds.cpp.o.d"
+  "CMakeFiles/extra_cmds.dir/polynomial_cmds.cpp.o"
+  "CMakeFiles/extra_cmds.dir/polynomial_cmds.cpp.o.d"
+  "CMakeFiles/extra_cmds.dir/proof_cmds.cpp.o"
+  "CMakeFiles/extra_cmds.dir/proof_cmds.cpp.o.d"
+  "CMakeFiles/extra_cmds.dir/subpaving_cmds.cpp.o"
+  "CMakeFiles/extra_cmds.dir/subpaving_cmds.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/extra_cmds.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
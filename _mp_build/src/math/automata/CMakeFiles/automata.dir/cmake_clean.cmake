@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/automata.dir/automaton.cpp.o"
+  "CMakeFiles/automata.dir/automaton.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/automata.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
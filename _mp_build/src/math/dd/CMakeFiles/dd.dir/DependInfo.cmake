@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/math/dd/dd_bdd.cpp" "src/math/dd/CMakeFiles/dd.dir/dd_bdd.cpp.o" "gcc" "src/math/dd/CMakeFiles/dd.dir/dd_bdd.cpp.o.d"
+  "/root/repo/src/math/dd/dd_fdd.cpp" "src/math/dd/CMakeFiles/dd.dir/dd_fdd.cpp.o" "gcc" "src/math/dd/CMakeFiles/dd.dir/dd_fdd.cpp.o.d"
+  "/root/repo/src/math/dd/dd_pdd.cpp" "src/math/dd/CMakeFiles/dd.dir/dd_pdd.cpp.o" "gcc" "src/math/dd/CMakeFiles/dd.dir/dd_pdd.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
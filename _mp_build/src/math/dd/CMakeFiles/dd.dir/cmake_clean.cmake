@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dd.dir/dd_bdd.cpp.o"
+  "CMakeFiles/dd.dir/dd_bdd.cpp.o.d"
+  "CMakeFiles/dd.dir/dd_fdd.cpp.o"
+  "CMakeFiles/dd.dir/dd_fdd.cpp.o.d"
+  "CMakeFiles/dd.dir/dd_pdd.cpp.o"
+  "CMakeFiles/dd.dir/dd_pdd.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/math/grobner/grobner.cpp" "src/math/grobner/CMakeFiles/grobner.dir/grobner.cpp.o" "gcc" "src/math/grobner/CMakeFiles/grobner.dir/grobner.cpp.o.d"
+  "/root/repo/src/math/grobner/pdd_simplifier.cpp" "src/math/grobner/CMakeFiles/grobner.dir/pdd_simplifier.cpp.o" "gcc" "src/math/grobner/CMakeFiles/grobner.dir/pdd_simplifier.cpp.o.d"
+  "/root/repo/src/math/grobner/pdd_solver.cpp" "src/math/grobner/CMakeFiles/grobner.dir/pdd_solver.cpp.o" "gcc" "src/math/grobner/CMakeFiles/grobner.dir/pdd_solver.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
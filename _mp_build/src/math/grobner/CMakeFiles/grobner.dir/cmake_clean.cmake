@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/grobner.dir/grobner.cpp.o"
+  "CMakeFiles/grobner.dir/grobner.cpp.o.d"
+  "CMakeFiles/grobner.dir/pdd_simplifier.cpp.o"
+  "CMakeFiles/grobner.dir/pdd_simplifier.cpp.o.d"
+  "CMakeFiles/grobner.dir/pdd_solver.cpp.o"
+  "CMakeFiles/grobner.dir/pdd_solver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/grobner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hilbert.dir/hilbert_basis.cpp.o"
+  "CMakeFiles/hilbert.dir/hilbert_basis.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hilbert.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/interval.dir/dep_intervals.cpp.o"
+  "CMakeFiles/interval.dir/dep_intervals.cpp.o.d"
+  "CMakeFiles/interval.dir/interval_mpq.cpp.o"
+  "CMakeFiles/interval.dir/interval_mpq.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/interval.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,56 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/math/lp/core_solver_pretty_printer.cpp" "src/math/lp/CMakeFiles/lp.dir/core_solver_pretty_printer.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/core_solver_pretty_printer.cpp.o.d"
+  "/root/repo/src/math/lp/dense_matrix.cpp" "src/math/lp/CMakeFiles/lp.dir/dense_matrix.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/dense_matrix.cpp.o.d"
+  "/root/repo/src/math/lp/dioph_eq.cpp" "src/math/lp/CMakeFiles/lp.dir/dioph_eq.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/dioph_eq.cpp.o.d"
+  "/root/repo/src/math/lp/emonics.cpp" "src/math/lp/CMakeFiles/lp.dir/emonics.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/emonics.cpp.o.d"
+  "/root/repo/src/math/lp/factorization.cpp" "src/math/lp/CMakeFiles/lp.dir/factorization.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/factorization.cpp.o.d"
+  "/root/repo/src/math/lp/factorization_factory_imp.cpp" "src/math/lp/CMakeFiles/lp.dir/factorization_factory_imp.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/factorization_factory_imp.cpp.o.d"
+  "/root/repo/src/math/lp/gomory.cpp" "src/math/lp/CMakeFiles/lp.dir/gomory.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/gomory.cpp.o.d"
+  "/root/repo/src/math/lp/hnf_cutter.cpp" "src/math/lp/CMakeFiles/lp.dir/hnf_cutter.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/hnf_cutter.cpp.o.d"
+  "/root/repo/src/math/lp/horner.cpp" "src/math/lp/CMakeFiles/lp.dir/horner.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/horner.cpp.o.d"
+  "/root/repo/src/math/lp/indexed_vector.cpp" "src/math/lp/CMakeFiles/lp.dir/indexed_vector.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/indexed_vector.cpp.o.d"
+  "/root/repo/src/math/lp/int_branch.cpp" "src/math/lp/CMakeFiles/lp.dir/int_branch.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/int_branch.cpp.o.d"
+  "/root/repo/src/math/lp/int_cube.cpp" "src/math/lp/CMakeFiles/lp.dir/int_cube.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/int_cube.cpp.o.d"
+  "/root/repo/src/math/lp/int_gcd_test.cpp" "src/math/lp/CMakeFiles/lp.dir/int_gcd_test.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/int_gcd_test.cpp.o.d"
+  "/root/repo/src/math/lp/int_solver.cpp" "src/math/lp/CMakeFiles/lp.dir/int_solver.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/int_solver.cpp.o.d"
+  "/root/repo/src/math/lp/lar_core_solver.cpp" "src/math/lp/CMakeFiles/lp.dir/lar_core_solver.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/lar_core_solver.cpp.o.d"
+  "/root/repo/src/math/lp/lar_solver.cpp" "src/math/lp/CMakeFiles/lp.dir/lar_solver.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/lar_solver.cpp.o.d"
+  "/root/repo/src/math/lp/lp_core_solver_base.cpp" "src/math/lp/CMakeFiles/lp.dir/lp_core_solver_base.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/lp_core_solver_base.cpp.o.d"
+  "/root/repo/src/math/lp/lp_primal_core_solver.cpp" "src/math/lp/CMakeFiles/lp.dir/lp_primal_core_solver.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/lp_primal_core_solver.cpp.o.d"
+  "/root/repo/src/math/lp/lp_settings.cpp" "src/math/lp/CMakeFiles/lp.dir/lp_settings.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/lp_settings.cpp.o.d"
+  "/root/repo/src/math/lp/matrix.cpp" "src/math/lp/CMakeFiles/lp.dir/matrix.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/matrix.cpp.o.d"
+  "/root/repo/src/math/lp/mon_eq.cpp" "src/math/lp/CMakeFiles/lp.dir/mon_eq.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/mon_eq.cpp.o.d"
+  "/root/repo/src/math/lp/monomial_bounds.cpp" "src/math/lp/CMakeFiles/lp.dir/monomial_bounds.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/monomial_bounds.cpp.o.d"
+  "/root/repo/src/math/lp/nex_creator.cpp" "src/math/lp/CMakeFiles/lp.dir/nex_creator.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/nex_creator.cpp.o.d"
+  "/root/repo/src/math/lp/nla_basics_lemmas.cpp" "src/math/lp/CMakeFiles/lp.dir/nla_basics_lemmas.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/nla_basics_lemmas.cpp.o.d"
+  "/root/repo/src/math/lp/nla_common.cpp" "src/math/lp/CMakeFiles/lp.dir/nla_common.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/nla_common.cpp.o.d"
+  "/root/repo/src/math/lp/nla_core.cpp" "src/math/lp/CMakeFiles/lp.dir/nla_core.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/nla_core.cpp.o.d"
+  "/root/repo/src/math/lp/nla_divisions.cpp" "src/math/lp/CMakeFiles/lp.dir/nla_divisions.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/nla_divisions.cpp.o.d"
+  "/root/repo/src/math/lp/nla_grobner.cpp" "src/math/lp/CMakeFiles/lp.dir/nla_grobner.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/nla_grobner.cpp.o.d"
+  "/root/repo/src/math/lp/nla_intervals.cpp" "src/math/lp/CMakeFiles/lp.dir/nla_intervals.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/nla_intervals.cpp.o.d"
+  "/root/repo/src/math/lp/nla_monotone_lemmas.cpp" "src/math/lp/CMakeFiles/lp.dir/nla_monotone_lemmas.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/nla_monotone_lemmas.cpp.o.d"
+  "/root/repo/src/math/lp/nla_order_lemmas.cpp" "src/math/lp/CMakeFiles/lp.dir/nla_order_lemmas.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/nla_order_lemmas.cpp.o.d"
+  "/root/repo/src/math/lp/nla_powers.cpp" "src/math/lp/CMakeFiles/lp.dir/nla_powers.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/nla_powers.cpp.o.d"
+  "/root/repo/src/math/lp/nla_solver.cpp" "src/math/lp/CMakeFiles/lp.dir/nla_solver.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/nla_solver.cpp.o.d"
+  "/root/repo/src/math/lp/nla_tangent_lemmas.cpp" "src/math/lp/CMakeFiles/lp.dir/nla_tangent_lemmas.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/nla_tangent_lemmas.cpp.o.d"
+  "/root/repo/src/math/lp/nra_solver.cpp" "src/math/lp/CMakeFiles/lp.dir/nra_solver.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/nra_solver.cpp.o.d"
+  "/root/repo/src/math/lp/permutation_matrix.cpp" "src/math/lp/CMakeFiles/lp.dir/permutation_matrix.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/permutation_matrix.cpp.o.d"
+  "/root/repo/src/math/lp/random_updater.cpp" "src/math/lp/CMakeFiles/lp.dir/random_updater.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/random_updater.cpp.o.d"
+  "/root/repo/src/math/lp/static_matrix.cpp" "src/math/lp/CMakeFiles/lp.dir/static_matrix.cpp.o" "gcc" "src/math/lp/CMakeFiles/lp.dir/static_matrix.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,83 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lp.dir/core_solver_pretty_printer.cpp.o"
+  "CMakeFiles/lp.dir/core_solver_pretty_printer.cpp.o.d"
+  "CMakeFiles/lp.dir/dense_matrix.cpp.o"
+  "CMakeFiles/lp.dir/dense_matrix.cpp.o.d"
+  "CMakeFiles/lp.dir/dioph_eq.cpp.o"
+  "CMakeFiles/lp.dir/dioph_eq.cpp.o.d"
+  "CMakeFiles/lp.dir/emonics.cpp.o"
+  "CMakeFiles/lp.dir/emonics.cpp.o.d"
+  "CMakeFiles/lp.dir/factorization.cpp.o"
+  "CMakeFiles/lp.dir/factorization.cpp.o.d"
+  "CMakeFiles/lp.dir/factorization_factory_imp.cpp.o"
+  "CMakeFiles/lp.dir/factorization_factory_imp.cpp.o.d"
+  "CMakeFiles/lp.dir/gomory.cpp.o"
+  "CMakeFiles/lp.dir/gomory.cpp.o.d"
+  "CMakeFiles/lp.dir/hnf_cutter.cpp.o"
+  "CMakeFiles/lp.dir/hnf_cutter.cpp.o.d"
+  "CMakeFiles/lp.dir/horner.cpp.o"
+  "CMakeFiles/lp.dir/horner.cpp.o.d"
+  "CMakeFiles/lp.dir/indexed_vector.cpp.o"
+  "CMakeFiles/lp.dir/indexed_vector.cpp.o.d"
+  "CMakeFiles/lp.dir/int_branch.cpp.o"
+  "CMakeFiles/lp.dir/int_branch.cpp.o.d"
+  "CMakeFiles/lp.dir/int_cube.cpp.o"
+  "CMakeFiles/lp.dir/int_cube.cpp.o.d"
+  "CMakeFiles/lp.dir/int_gcd_test.cpp.o"
+  "CMakeFiles/lp.dir/int_gcd_test.cpp.o.d"
+  "CMakeFiles/lp.dir/int_solver.cpp.o"
+  "CMakeFiles/lp.dir/int_solver.cpp.o.d"
+  "CMakeFiles/lp.dir/lar_core_solver.cpp.o"
+  "CMakeFiles/lp.dir/lar_core_solver.cpp.o.d"
+  "CMakeFiles/lp.dir/lar_solver.cpp.o"
+  "CMakeFiles/lp.dir/lar_solver.cpp.o.d"
+  "CMakeFiles/lp.dir/lp_core_solver_base.cpp.o"
+  "CMakeFiles/lp.dir/lp_core_solver_base.cpp.o.d"
+  "CMakeFiles/lp.dir/lp_primal_core_solver.cpp.o"
+  "CMakeFiles/lp.dir/lp_primal_core_solver.cpp.o.d"
+  "CMakeFiles/lp.dir/lp_settings.cpp.o"
+  "CMakeFiles/lp.dir/lp_settings.cpp.o.d"
+  "CMakeFiles/lp.dir/matrix.cpp.o"
+  "CMakeFiles/lp.dir/matrix.cpp.o.d"
+  "CMakeFiles/lp.dir/mon_eq.cpp.o"
+  "CMakeFiles/lp.dir/mon_eq.cpp.o.d"
+  "CMakeFiles/lp.dir/monomial_bounds.cpp.o"
+  "CMakeFiles/lp.dir/monomial_bounds.cpp.o.d"
+  "CMakeFiles/lp.dir/nex_creator.cpp.o"
+  "CMakeFiles/lp.dir/nex_creator.cpp.o.d"
+  "CMakeFiles/lp.dir/nla_basics_lemmas.cpp.o"
+  "CMakeFiles/lp.dir/nla_basics_lemmas.cpp.o.d"
+  "CMakeFiles/lp.dir/nla_common.cpp.o"
+  "CMakeFiles/lp.dir/nla_common.cpp.o.d"
+  "CMakeFiles/lp.dir/nla_core.cpp.o"
+  "CMakeFiles/lp.dir/nla_core.cpp.o.d"
+  "CMakeFiles/lp.dir/nla_divisions.cpp.o"
+  "CMakeFiles/lp.dir/nla_divisions.cpp.o.d"
+  "CMakeFiles/lp.dir/nla_grobner.cpp.o"
+  "CMakeFiles/lp.dir/nla_grobner.cpp.o.d"
+  "CMakeFiles/lp.dir/nla_intervals.cpp.o"
+  "CMakeFiles/lp.dir/nla_intervals.cpp.o.d"
+  "CMakeFiles/lp.dir/nla_monotone_lemmas.cpp.o"
+  "CMakeFiles/lp.dir/nla_monotone_lemmas.cpp.o.d"
+  "CMakeFiles/lp.dir/nla_order_lemmas.cpp.o"
+  "CMakeFiles/lp.dir/nla_order_lemmas.cpp.o.d"
+  "CMakeFiles/lp.dir/nla_powers.cpp.o"
+  "CMakeFiles/lp.dir/nla_powers.cpp.o.d"
+  "CMakeFiles/lp.dir/nla_solver.cpp.o"
+  "CMakeFiles/lp.dir/nla_solver.cpp.o.d"
+  "CMakeFiles/lp.dir/nla_tangent_lemmas.cpp.o"
+  "CMakeFiles/lp.dir/nla_tangent_lemmas.cpp.o.d"
+  "CMakeFiles/lp.dir/nra_solver.cpp.o"
+  "CMakeFiles/lp.dir/nra_solver.cpp.o.d"
+  "CMakeFiles/lp.dir/permutation_matrix.cpp.o"
+  "CMakeFiles/lp.dir/permutation_matrix.cpp.o.d"
+  "CMakeFiles/lp.dir/random_updater.cpp.o"
+  "CMakeFiles/lp.dir/random_updater.cpp.o.d"
+  "CMakeFiles/lp.dir/static_matrix.cpp.o"
+  "CMakeFiles/lp.dir/static_matrix.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/math/polynomial/algebraic_numbers.cpp" "src/math/polynomial/CMakeFiles/polynomial.dir/algebraic_numbers.cpp.o" "gcc" "src/math/polynomial/CMakeFiles/polynomial.dir/algebraic_numbers.cpp.o.d"
+  "/root/repo/src/math/polynomial/polynomial.cpp" "src/math/polynomial/CMakeFiles/polynomial.dir/polynomial.cpp.o" "gcc" "src/math/polynomial/CMakeFiles/polynomial.dir/polynomial.cpp.o.d"
+  "/root/repo/src/math/polynomial/polynomial_cache.cpp" "src/math/polynomial/CMakeFiles/polynomial.dir/polynomial_cache.cpp.o" "gcc" "src/math/polynomial/CMakeFiles/polynomial.dir/polynomial_cache.cpp.o.d"
+  "/root/repo/src/math/polynomial/rpolynomial.cpp" "src/math/polynomial/CMakeFiles/polynomial.dir/rpolynomial.cpp.o" "gcc" "src/math/polynomial/CMakeFiles/polynomial.dir/rpolynomial.cpp.o.d"
+  "/root/repo/src/math/polynomial/sexpr2upolynomial.cpp" "src/math/polynomial/CMakeFiles/polynomial.dir/sexpr2upolynomial.cpp.o" "gcc" "src/math/polynomial/CMakeFiles/polynomial.dir/sexpr2upolynomial.cpp.o.d"
+  "/root/repo/src/math/polynomial/upolynomial.cpp" "src/math/polynomial/CMakeFiles/polynomial.dir/upolynomial.cpp.o" "gcc" "src/math/polynomial/CMakeFiles/polynomial.dir/upolynomial.cpp.o.d"
+  "/root/repo/src/math/polynomial/upolynomial_factorization.cpp" "src/math/polynomial/CMakeFiles/polynomial.dir/upolynomial_factorization.cpp.o" "gcc" "src/math/polynomial/CMakeFiles/polynomial.dir/upolynomial_factorization.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,22 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomial.dir/algebraic_numbers.cpp.o"
+  "CMakeFiles/polynomial.dir/algebraic_numbers.cpp.o.d"
+  "CMakeFiles/polynomial.dir/polynomial.cpp.o"
+  "CMakeFiles/polynomial.dir/polynomial.cpp.o.d"
+  "CMakeFiles/polynomial.dir/polynomial_cache.cpp.o"
+  "CMakeFiles/polynomial.dir/polynomial_cache.cpp.o.d"
+  "CMakeFiles/polynomial.dir/rpolynomial.cpp.o"
+  "CMakeFiles/polynomial.dir/rpolynomial.cpp.o.d"
+  "CMakeFiles/polynomial.dir/sexpr2upolynomial.cpp.o"
+  "CMakeFiles/polynomial.dir/sexpr2upolynomial.cpp.o.d"
+  "CMakeFiles/polynomial.dir/upolynomial.cpp.o"
+  "CMakeFiles/polynomial.dir/upolynomial.cpp.o.d"
+  "CMakeFiles/polynomial.dir/upolynomial_factorization.cpp.o"
+  "CMakeFiles/polynomial.dir/upolynomial_factorization.cpp.o.d"
+  "algebraic_params.hpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/realclosure.dir/mpz_matrix.cpp.o"
+  "CMakeFiles/realclosure.dir/mpz_matrix.cpp.o.d"
+  "CMakeFiles/realclosure.dir/realclosure.cpp.o"
+  "CMakeFiles/realclosure.dir/realclosure.cpp.o.d"
+  "rcf_params.hpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/realclosure.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/math/simplex/bit_matrix.cpp" "src/math/simplex/CMakeFiles/simplex.dir/bit_matrix.cpp.o" "gcc" "src/math/simplex/CMakeFiles/simplex.dir/bit_matrix.cpp.o.d"
+  "/root/repo/src/math/simplex/model_based_opt.cpp" "src/math/simplex/CMakeFiles/simplex.dir/model_based_opt.cpp.o" "gcc" "src/math/simplex/CMakeFiles/simplex.dir/model_based_opt.cpp.o.d"
+  "/root/repo/src/math/simplex/simplex.cpp" "src/math/simplex/CMakeFiles/simplex.dir/simplex.cpp.o" "gcc" "src/math/simplex/CMakeFiles/simplex.dir/simplex.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simplex.dir/bit_matrix.cpp.o"
+  "CMakeFiles/simplex.dir/bit_matrix.cpp.o.d"
+  "CMakeFiles/simplex.dir/model_based_opt.cpp.o"
+  "CMakeFiles/simplex.dir/model_based_opt.cpp.o.d"
+  "CMakeFiles/simplex.dir/simplex.cpp.o"
+  "CMakeFiles/simplex.dir/simplex.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simplex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
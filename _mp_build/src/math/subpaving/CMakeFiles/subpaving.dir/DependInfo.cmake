@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/math/subpaving/subpaving.cpp" "src/math/subpaving/CMakeFiles/subpaving.dir/subpaving.cpp.o" "gcc" "src/math/subpaving/CMakeFiles/subpaving.dir/subpaving.cpp.o.d"
+  "/root/repo/src/math/subpaving/subpaving_hwf.cpp" "src/math/subpaving/CMakeFiles/subpaving.dir/subpaving_hwf.cpp.o" "gcc" "src/math/subpaving/CMakeFiles/subpaving.dir/subpaving_hwf.cpp.o.d"
+  "/root/repo/src/math/subpaving/subpaving_mpf.cpp" "src/math/subpaving/CMakeFiles/subpaving.dir/subpaving_mpf.cpp.o" "gcc" "src/math/subpaving/CMakeFiles/subpaving.dir/subpaving_mpf.cpp.o.d"
+  "/root/repo/src/math/subpaving/subpaving_mpff.cpp" "src/math/subpaving/CMakeFiles/subpaving.dir/subpaving_mpff.cpp.o" "gcc" "src/math/subpaving/CMakeFiles/subpaving.dir/subpaving_mpff.cpp.o.d"
+  "/root/repo/src/math/subpaving/subpaving_mpfx.cpp" "src/math/subpaving/CMakeFiles/subpaving.dir/subpaving_mpfx.cpp.o" "gcc" "src/math/subpaving/CMakeFiles/subpaving.dir/subpaving_mpfx.cpp.o.d"
+  "/root/repo/src/math/subpaving/subpaving_mpq.cpp" "src/math/subpaving/CMakeFiles/subpaving.dir/subpaving_mpq.cpp.o" "gcc" "src/math/subpaving/CMakeFiles/subpaving.dir/subpaving_mpq.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/subpaving.dir/subpaving.cpp.o"
+  "CMakeFiles/subpaving.dir/subpaving.cpp.o.d"
+  "CMakeFiles/subpaving.dir/subpaving_hwf.cpp.o"
+  "CMakeFiles/subpaving.dir/subpaving_hwf.cpp.o.d"
+  "CMakeFiles/subpaving.dir/subpaving_mpf.cpp.o"
+  "CMakeFiles/subpaving.dir/subpaving_mpf.cpp.o.d"
+  "CMakeFiles/subpaving.dir/subpaving_mpff.cpp.o"
+  "CMakeFiles/subpaving.dir/subpaving_mpff.cpp.o.d"
+  "CMakeFiles/subpaving.dir/subpaving_mpfx.cpp.o"
+  "CMakeFiles/subpaving.dir/subpaving_mpfx.cpp.o.d"
+  "CMakeFiles/subpaving.dir/subpaving_mpq.cpp.o"
+  "CMakeFiles/subpaving.dir/subpaving_mpq.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/subpaving.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
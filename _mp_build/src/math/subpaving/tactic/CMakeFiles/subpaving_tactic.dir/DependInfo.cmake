@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/math/subpaving/tactic/expr2subpaving.cpp" "src/math/subpaving/tactic/CMakeFiles/subpaving_tactic.dir/expr2subpaving.cpp.o" "gcc" "src/math/subpaving/tactic/CMakeFiles/subpaving_tactic.dir/expr2subpaving.cpp.o.d"
+  "/root/repo/src/math/subpaving/tactic/subpaving_tactic.cpp" "src/math/subpaving/tactic/CMakeFiles/subpaving_tactic.dir/subpaving_tactic.cpp.o" "gcc" "src/math/subpaving/tactic/CMakeFiles/subpaving_tactic.dir/subpaving_tactic.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
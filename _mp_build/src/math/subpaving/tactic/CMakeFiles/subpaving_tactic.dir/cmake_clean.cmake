@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/subpaving_tactic.dir/expr2subpaving.cpp.o"
+  "CMakeFiles/subpaving_tactic.dir/expr2subpaving.cpp.o.d"
+  "CMakeFiles/subpaving_tactic.dir/subpaving_tactic.cpp.o"
+  "CMakeFiles/subpaving_tactic.dir/subpaving_tactic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/subpaving_tactic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
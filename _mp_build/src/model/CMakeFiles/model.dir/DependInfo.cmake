@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/model/array_factory.cpp" "src/model/CMakeFiles/model.dir/array_factory.cpp.o" "gcc" "src/model/CMakeFiles/model.dir/array_factory.cpp.o.d"
+  "/root/repo/src/model/datatype_factory.cpp" "src/model/CMakeFiles/model.dir/datatype_factory.cpp.o" "gcc" "src/model/CMakeFiles/model.dir/datatype_factory.cpp.o.d"
+  "/root/repo/src/model/func_interp.cpp" "src/model/CMakeFiles/model.dir/func_interp.cpp.o" "gcc" "src/model/CMakeFiles/model.dir/func_interp.cpp.o.d"
+  "/root/repo/src/model/model.cpp" "src/model/CMakeFiles/model.dir/model.cpp.o" "gcc" "src/model/CMakeFiles/model.dir/model.cpp.o.d"
+  "/root/repo/src/model/model2expr.cpp" "src/model/CMakeFiles/model.dir/model2expr.cpp.o" "gcc" "src/model/CMakeFiles/model.dir/model2expr.cpp.o.d"
+  "/root/repo/src/model/model_core.cpp" "src/model/CMakeFiles/model.dir/model_core.cpp.o" "gcc" "src/model/CMakeFiles/model.dir/model_core.cpp.o.d"
+  "/root/repo/src/model/model_evaluator.cpp" "src/model/CMakeFiles/model.dir/model_evaluator.cpp.o" "gcc" "src/model/CMakeFiles/model.dir/model_evaluator.cpp.o.d"
+  "/root/repo/src/model/model_implicant.cpp" "src/model/CMakeFiles/model.dir/model_implicant.cpp.o" "gcc" "src/model/CMakeFiles/model.dir/model_implicant.cpp.o.d"
+  "/root/repo/src/model/model_macro_solver.cpp" "src/model/CMakeFiles/model.dir/model_macro_solver.cpp.o" "gcc" "src/model/CMakeFiles/model.dir/model_macro_solver.cpp.o.d"
+  "/root/repo/src/model/model_pp.cpp" "src/model/CMakeFiles/model.dir/model_pp.cpp.o" "gcc" "src/model/CMakeFiles/model.dir/model_pp.cpp.o.d"
+  "/root/repo/src/model/model_smt2_pp.cpp" "src/model/CMakeFiles/model.dir/model_smt2_pp.cpp.o" "gcc" "src/model/CMakeFiles/model.dir/model_smt2_pp.cpp.o.d"
+  "/root/repo/src/model/model_v2_pp.cpp" "src/model/CMakeFiles/model.dir/model_v2_pp.cpp.o" "gcc" "src/model/CMakeFiles/model.dir/model_v2_pp.cpp.o.d"
+  "/root/repo/src/model/numeral_factory.cpp" "src/model/CMakeFiles/model.dir/numeral_factory.cpp.o" "gcc" "src/model/CMakeFiles/model.dir/numeral_factory.cpp.o.d"
+  "/root/repo/src/model/struct_factory.cpp" "src/model/CMakeFiles/model.dir/struct_factory.cpp.o" "gcc" "src/model/CMakeFiles/model.dir/struct_factory.cpp.o.d"
+  "/root/repo/src/model/value_factory.cpp" "src/model/CMakeFiles/model.dir/value_factory.cpp.o" "gcc" "src/model/CMakeFiles/model.dir/value_factory.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/model.dir/array_factory.cpp.o"
+  "CMakeFiles/model.dir/array_factory.cpp.o.d"
+  "CMakeFiles/model.dir/datatype_factory.cpp.o"
+  "CMakeFiles/model.dir/datatype_factory.cpp.o.d"
+  "CMakeFiles/model.dir/func_interp.cpp.o"
+  "CMakeFiles/model.dir/func_interp.cpp.o.d"
+  "CMakeFiles/model.dir/model.cpp.o"
+  "CMakeFiles/model.dir/model.cpp.o.d"
+  "CMakeFiles/model.dir/model2expr.cpp.o"
+  "CMakeFiles/model.dir/model2expr.cpp.o.d"
+  "CMakeFiles/model.dir/model_core.cpp.o"
+  "CMakeFiles/model.dir/model_core.cpp.o.d"
+  "CMakeFiles/model.dir/model_evaluator.cpp.o"
+  "CMakeFiles/model.dir/model_evaluator.cpp.o.d"
+  "CMakeFiles/model.dir/model_implicant.cpp.o"
+  "CMakeFiles/model.dir/model_implicant.cpp.o.d"
+  "CMakeFiles/model.dir/model_macro_solver.cpp.o"
+  "CMakeFiles/model.dir/model_macro_solver.cpp.o.d"
+  "CMakeFiles/model.dir/model_pp.cpp.o"
+  "CMakeFiles/model.dir/model_pp.cpp.o.d"
+  "CMakeFiles/model.dir/model_smt2_pp.cpp.o"
+  "CMakeFiles/model.dir/model_smt2_pp.cpp.o.d"
+  "CMakeFiles/model.dir/model_v2_pp.cpp.o"
+  "CMakeFiles/model.dir/model_v2_pp.cpp.o.d"
+  "CMakeFiles/model.dir/numeral_factory.cpp.o"
+  "CMakeFiles/model.dir/numeral_factory.cpp.o.d"
+  "CMakeFiles/model.dir/struct_factory.cpp.o"
+  "CMakeFiles/model.dir/struct_factory.cpp.o.d"
+  "CMakeFiles/model.dir/value_factory.cpp.o"
+  "CMakeFiles/model.dir/value_factory.cpp.o.d"
+  "model_evaluator_params.hpp"
+  "model_params.hpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/model.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
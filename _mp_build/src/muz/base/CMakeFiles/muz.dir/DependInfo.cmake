@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/muz/base/bind_variables.cpp" "src/muz/base/CMakeFiles/muz.dir/bind_variables.cpp.o" "gcc" "src/muz/base/CMakeFiles/muz.dir/bind_variables.cpp.o.d"
+  "/root/repo/src/muz/base/dl_boogie_proof.cpp" "src/muz/base/CMakeFiles/muz.dir/dl_boogie_proof.cpp.o" "gcc" "src/muz/base/CMakeFiles/muz.dir/dl_boogie_proof.cpp.o.d"
+  "/root/repo/src/muz/base/dl_context.cpp" "src/muz/base/CMakeFiles/muz.dir/dl_context.cpp.o" "gcc" "src/muz/base/CMakeFiles/muz.dir/dl_context.cpp.o.d"
+  "/root/repo/src/muz/base/dl_costs.cpp" "src/muz/base/CMakeFiles/muz.dir/dl_costs.cpp.o" "gcc" "src/muz/base/CMakeFiles/muz.dir/dl_costs.cpp.o.d"
+  "/root/repo/src/muz/base/dl_rule.cpp" "src/muz/base/CMakeFiles/muz.dir/dl_rule.cpp.o" "gcc" "src/muz/base/CMakeFiles/muz.dir/dl_rule.cpp.o.d"
+  "/root/repo/src/muz/base/dl_rule_set.cpp" "src/muz/base/CMakeFiles/muz.dir/dl_rule_set.cpp.o" "gcc" "src/muz/base/CMakeFiles/muz.dir/dl_rule_set.cpp.o.d"
+  "/root/repo/src/muz/base/dl_rule_subsumption_index.cpp" "src/muz/base/CMakeFiles/muz.dir/dl_rule_subsumption_index.cpp.o" "gcc" "src/muz/base/CMakeFiles/muz.dir/dl_rule_subsumption_index.cpp.o.d"
+  "/root/repo/src/muz/base/dl_rule_transformer.cpp" "src/muz/base/CMakeFiles/muz.dir/dl_rule_transformer.cpp.o" "gcc" "src/muz/base/CMakeFiles/muz.dir/dl_rule_transformer.cpp.o.d"
+  "/root/repo/src/muz/base/dl_util.cpp" "src/muz/base/CMakeFiles/muz.dir/dl_util.cpp.o" "gcc" "src/muz/base/CMakeFiles/muz.dir/dl_util.cpp.o.d"
+  "/root/repo/src/muz/base/hnf.cpp" "src/muz/base/CMakeFiles/muz.dir/hnf.cpp.o" "gcc" "src/muz/base/CMakeFiles/muz.dir/hnf.cpp.o.d"
+  "/root/repo/src/muz/base/rule_properties.cpp" "src/muz/base/CMakeFiles/muz.dir/rule_properties.cpp.o" "gcc" "src/muz/base/CMakeFiles/muz.dir/rule_properties.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
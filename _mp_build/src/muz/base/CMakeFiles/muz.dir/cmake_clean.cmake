@@ -0,0 +1,30 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/muz.dir/bind_variables.cpp.o"
+  "CMakeFiles/muz.dir/bind_variables.cpp.o.d"
+  "CMakeFiles/muz.dir/dl_boogie_proof.cpp.o"
+  "CMakeFiles/muz.dir/dl_boogie_proof.cpp.o.d"
+  "CMakeFiles/muz.dir/dl_context.cpp.o"
+  "CMakeFiles/muz.dir/dl_context.cpp.o.d"
+  "CMakeFiles/muz.dir/dl_costs.cpp.o"
+  "CMakeFiles/muz.dir/dl_costs.cpp.o.d"
+  "CMakeFiles/muz.dir/dl_rule.cpp.o"
+  "CMakeFiles/muz.dir/dl_rule.cpp.o.d"
+  "CMakeFiles/muz.dir/dl_rule_set.cpp.o"
+  "CMakeFiles/muz.dir/dl_rule_set.cpp.o.d"
+  "CMakeFiles/muz.dir/dl_rule_subsumption_index.cpp.o"
+  "CMakeFiles/muz.dir/dl_rule_subsumption_index.cpp.o.d"
+  "CMakeFiles/muz.dir/dl_rule_transformer.cpp.o"
+  "CMakeFiles/muz.dir/dl_rule_transformer.cpp.o.d"
+  "CMakeFiles/muz.dir/dl_util.cpp.o"
+  "CMakeFiles/muz.dir/dl_util.cpp.o.d"
+  "CMakeFiles/muz.dir/hnf.cpp.o"
+  "CMakeFiles/muz.dir/hnf.cpp.o.d"
+  "CMakeFiles/muz.dir/rule_properties.cpp.o"
+  "CMakeFiles/muz.dir/rule_properties.cpp.o.d"
+  "fp_params.hpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/muz.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
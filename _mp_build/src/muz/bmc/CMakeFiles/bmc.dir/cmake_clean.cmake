@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bmc.dir/dl_bmc_engine.cpp.o"
+  "CMakeFiles/bmc.dir/dl_bmc_engine.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bmc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
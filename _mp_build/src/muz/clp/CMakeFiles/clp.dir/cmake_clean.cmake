@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clp.dir/clp_context.cpp.o"
+  "CMakeFiles/clp.dir/clp_context.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ddnf.dir/ddnf.cpp.o"
+  "CMakeFiles/ddnf.dir/ddnf.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ddnf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
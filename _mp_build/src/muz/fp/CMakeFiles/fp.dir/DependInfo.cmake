@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/muz/fp/datalog_parser.cpp" "src/muz/fp/CMakeFiles/fp.dir/datalog_parser.cpp.o" "gcc" "src/muz/fp/CMakeFiles/fp.dir/datalog_parser.cpp.o.d"
+  "/root/repo/src/muz/fp/dl_cmds.cpp" "src/muz/fp/CMakeFiles/fp.dir/dl_cmds.cpp.o" "gcc" "src/muz/fp/CMakeFiles/fp.dir/dl_cmds.cpp.o.d"
+  "/root/repo/src/muz/fp/dl_register_engine.cpp" "src/muz/fp/CMakeFiles/fp.dir/dl_register_engine.cpp.o" "gcc" "src/muz/fp/CMakeFiles/fp.dir/dl_register_engine.cpp.o.d"
+  "/root/repo/src/muz/fp/horn_tactic.cpp" "src/muz/fp/CMakeFiles/fp.dir/horn_tactic.cpp.o" "gcc" "src/muz/fp/CMakeFiles/fp.dir/horn_tactic.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
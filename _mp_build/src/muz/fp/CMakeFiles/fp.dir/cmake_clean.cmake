@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fp.dir/datalog_parser.cpp.o"
+  "CMakeFiles/fp.dir/datalog_parser.cpp.o.d"
+  "CMakeFiles/fp.dir/dl_cmds.cpp.o"
+  "CMakeFiles/fp.dir/dl_cmds.cpp.o.d"
+  "CMakeFiles/fp.dir/dl_register_engine.cpp.o"
+  "CMakeFiles/fp.dir/dl_register_engine.cpp.o.d"
+  "CMakeFiles/fp.dir/horn_tactic.cpp.o"
+  "CMakeFiles/fp.dir/horn_tactic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,45 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/muz/rel/aig_exporter.cpp" "src/muz/rel/CMakeFiles/rel.dir/aig_exporter.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/aig_exporter.cpp.o.d"
+  "/root/repo/src/muz/rel/check_relation.cpp" "src/muz/rel/CMakeFiles/rel.dir/check_relation.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/check_relation.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_base.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_base.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_base.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_bound_relation.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_bound_relation.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_bound_relation.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_check_table.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_check_table.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_check_table.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_columnar_table.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_columnar_table.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_columnar_table.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_compiler.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_compiler.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_compiler.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_external_relation.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_external_relation.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_external_relation.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_finite_product_relation.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_finite_product_relation.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_finite_product_relation.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_instruction.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_instruction.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_instruction.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_interval_relation.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_interval_relation.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_interval_relation.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_lazy_table.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_lazy_table.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_lazy_table.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_leapfrog_join.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_leapfrog_join.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_leapfrog_join.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_mk_explanations.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_mk_explanations.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_mk_explanations.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_mk_similarity_compressor.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_mk_similarity_compressor.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_mk_similarity_compressor.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_mk_simple_joins.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_mk_simple_joins.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_mk_simple_joins.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_product_relation.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_product_relation.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_product_relation.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_relation_manager.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_relation_manager.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_relation_manager.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_relation_store.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_relation_store.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_relation_store.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_sieve_relation.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_sieve_relation.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_sieve_relation.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_sparse_table.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_sparse_table.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_sparse_table.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_table.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_table.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_table.cpp.o.d"
+  "/root/repo/src/muz/rel/dl_table_relation.cpp" "src/muz/rel/CMakeFiles/rel.dir/dl_table_relation.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/dl_table_relation.cpp.o.d"
+  "/root/repo/src/muz/rel/doc.cpp" "src/muz/rel/CMakeFiles/rel.dir/doc.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/doc.cpp.o.d"
+  "/root/repo/src/muz/rel/karr_relation.cpp" "src/muz/rel/CMakeFiles/rel.dir/karr_relation.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/karr_relation.cpp.o.d"
+  "/root/repo/src/muz/rel/rel_context.cpp" "src/muz/rel/CMakeFiles/rel.dir/rel_context.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/rel_context.cpp.o.d"
+  "/root/repo/src/muz/rel/udoc_relation.cpp" "src/muz/rel/CMakeFiles/rel.dir/udoc_relation.cpp.o" "gcc" "src/muz/rel/CMakeFiles/rel.dir/udoc_relation.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rel.dir/aig_exporter.cpp.o"
+  "CMakeFiles/rel.dir/aig_exporter.cpp.o.d"
+  "CMakeFiles/rel.dir/check_relation.cpp.o"
+  "CMakeFiles/rel.dir/check_relation.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_base.cpp.o"
+  "CMakeFiles/rel.dir/dl_base.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_bound_relation.cpp.o"
+  "CMakeFiles/rel.dir/dl_bound_relation.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_check_table.cpp.o"
+  "CMakeFiles/rel.dir/dl_check_table.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_columnar_table.cpp.o"
+  "CMakeFiles/rel.dir/dl_columnar_table.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_compiler.cpp.o"
+  "CMakeFiles/rel.dir/dl_compiler.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_external_relation.cpp.o"
+  "CMakeFiles/rel.dir/dl_external_relation.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_finite_product_relation.cpp.o"
+  "CMakeFiles/rel.dir/dl_finite_product_relation.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_instruction.cpp.o"
+  "CMakeFiles/rel.dir/dl_instruction.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_interval_relation.cpp.o"
+  "CMakeFiles/rel.dir/dl_interval_relation.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_lazy_table.cpp.o"
+  "CMakeFiles/rel.dir/dl_lazy_table.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_leapfrog_join.cpp.o"
+  "CMakeFiles/rel.dir/dl_leapfrog_join.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_mk_explanations.cpp.o"
+  "CMakeFiles/rel.dir/dl_mk_explanations.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_mk_similarity_compressor.cpp.o"
+  "CMakeFiles/rel.dir/dl_mk_similarity_compressor.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_mk_simple_joins.cpp.o"
+  "CMakeFiles/rel.dir/dl_mk_simple_joins.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_product_relation.cpp.o"
+  "CMakeFiles/rel.dir/dl_product_relation.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_relation_manager.cpp.o"
+  "CMakeFiles/rel.dir/dl_relation_manager.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_relation_store.cpp.o"
+  "CMakeFiles/rel.dir/dl_relation_store.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_sieve_relation.cpp.o"
+  "CMakeFiles/rel.dir/dl_sieve_relation.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_sparse_table.cpp.o"
+  "CMakeFiles/rel.dir/dl_sparse_table.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_table.cpp.o"
+  "CMakeFiles/rel.dir/dl_table.cpp.o.d"
+  "CMakeFiles/rel.dir/dl_table_relation.cpp.o"
+  "CMakeFiles/rel.dir/dl_table_relation.cpp.o.d"
+  "CMakeFiles/rel.dir/doc.cpp.o"
+  "CMakeFiles/rel.dir/doc.cpp.o.d"
+  "CMakeFiles/rel.dir/karr_relation.cpp.o"
+  "CMakeFiles/rel.dir/karr_relation.cpp.o.d"
+  "CMakeFiles/rel.dir/rel_context.cpp.o"
+  "CMakeFiles/rel.dir/rel_context.cpp.o.d"
+  "CMakeFiles/rel.dir/udoc_relation.cpp.o"
+  "CMakeFiles/rel.dir/udoc_relation.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,55 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/muz/spacer/spacer_antiunify.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_antiunify.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_antiunify.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_arith_generalizers.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_arith_generalizers.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_arith_generalizers.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_arith_kernel.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_arith_kernel.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_arith_kernel.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_callback.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_callback.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_callback.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_cluster.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_cluster.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_cluster.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_cluster_util.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_cluster_util.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_cluster_util.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_concretize.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_concretize.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_concretize.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_conjecture.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_conjecture.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_conjecture.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_context.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_context.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_context.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_convex_closure.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_convex_closure.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_convex_closure.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_dl_interface.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_dl_interface.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_dl_interface.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_expand_bnd_generalizer.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_expand_bnd_generalizer.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_expand_bnd_generalizer.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_farkas_learner.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_farkas_learner.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_farkas_learner.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_generalizers.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_generalizers.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_generalizers.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_global_generalizer.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_global_generalizer.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_global_generalizer.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_ind_lemma_generalizer.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_ind_lemma_generalizer.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_ind_lemma_generalizer.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_iuc_proof.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_iuc_proof.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_iuc_proof.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_iuc_solver.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_iuc_solver.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_iuc_solver.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_legacy_frames.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_legacy_frames.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_legacy_frames.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_legacy_mbp.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_legacy_mbp.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_legacy_mbp.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_legacy_mev.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_legacy_mev.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_legacy_mev.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_manager.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_manager.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_manager.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_matrix.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_matrix.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_matrix.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_mbc.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_mbc.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_mbc.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_mev_array.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_mev_array.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_mev_array.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_parallel.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_parallel.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_parallel.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_pdr.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_pdr.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_pdr.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_proof_utils.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_proof_utils.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_proof_utils.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_prop_solver.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_prop_solver.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_prop_solver.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_qe_project.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_qe_project.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_qe_project.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_quant_generalizer.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_quant_generalizer.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_quant_generalizer.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_sat_answer.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_sat_answer.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_sat_answer.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_sem_matcher.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_sem_matcher.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_sem_matcher.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_sym_mux.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_sym_mux.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_sym_mux.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_unsat_core_learner.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_unsat_core_learner.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_unsat_core_learner.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_unsat_core_plugin.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_unsat_core_plugin.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_unsat_core_plugin.cpp.o.d"
+  "/root/repo/src/muz/spacer/spacer_util.cpp" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_util.cpp.o" "gcc" "src/muz/spacer/CMakeFiles/spacer.dir/spacer_util.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,81 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/spacer.dir/spacer_antiunify.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_antiunify.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_arith_generalizers.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_arith_generalizers.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_arith_kernel.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_arith_kernel.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_callback.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_callback.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_cluster.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_cluster.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_cluster_util.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_cluster_util.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_concretize.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_concretize.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_conjecture.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_conjecture.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_context.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_context.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_convex_closure.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_convex_closure.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_dl_interface.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_dl_interface.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_expand_bnd_generalizer.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_expand_bnd_generalizer.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_farkas_learner.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_farkas_learner.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_generalizers.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_generalizers.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_global_generalizer.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_global_generalizer.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_ind_lemma_generalizer.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_ind_lemma_generalizer.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_iuc_proof.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_iuc_proof.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_iuc_solver.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_iuc_solver.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_legacy_frames.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_legacy_frames.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_legacy_mbp.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_legacy_mbp.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_legacy_mev.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_legacy_mev.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_manager.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_manager.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_matrix.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_matrix.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_mbc.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_mbc.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_mev_array.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_mev_array.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_parallel.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_parallel.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_pdr.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_pdr.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_proof_utils.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_proof_utils.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_prop_solver.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_prop_solver.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_qe_project.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_qe_project.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_quant_generalizer.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_quant_generalizer.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_sat_answer.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_sat_answer.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_sem_matcher.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_sem_matcher.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_sym_mux.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_sym_mux.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_unsat_core_learner.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_unsat_core_learner.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_unsat_core_plugin.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_unsat_core_plugin.cpp.o.d"
+  "CMakeFiles/spacer.dir/spacer_util.cpp.o"
+  "CMakeFiles/spacer.dir/spacer_util.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/spacer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
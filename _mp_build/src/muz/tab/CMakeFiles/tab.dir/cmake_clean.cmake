@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tab.dir/tab_context.cpp.o"
+  "CMakeFiles/tab.dir/tab_context.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tab.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/muz/transforms/dl_mk_array_blast.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_array_blast.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_array_blast.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_array_eq_rewrite.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_array_eq_rewrite.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_array_eq_rewrite.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_array_instantiation.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_array_instantiation.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_array_instantiation.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_backwards.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_backwards.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_backwards.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_bit_blast.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_bit_blast.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_bit_blast.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_coalesce.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_coalesce.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_coalesce.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_coi_filter.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_coi_filter.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_coi_filter.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_elim_term_ite.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_elim_term_ite.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_elim_term_ite.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_filter_rules.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_filter_rules.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_filter_rules.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_interp_tail_simplifier.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_interp_tail_simplifier.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_interp_tail_simplifier.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_karr_invariants.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_karr_invariants.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_karr_invariants.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_loop_counter.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_loop_counter.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_loop_counter.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_magic_sets.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_magic_sets.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_magic_sets.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_magic_symbolic.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_magic_symbolic.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_magic_symbolic.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_quantifier_abstraction.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_quantifier_abstraction.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_quantifier_abstraction.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_quantifier_instantiation.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_quantifier_instantiation.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_quantifier_instantiation.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_rule_inliner.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_rule_inliner.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_rule_inliner.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_scale.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_scale.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_scale.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_separate_negated_tails.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_separate_negated_tails.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_separate_negated_tails.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_slice.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_slice.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_slice.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_subsumption_checker.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_subsumption_checker.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_subsumption_checker.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_synchronize.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_synchronize.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_synchronize.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_unbound_compressor.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_unbound_compressor.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_unbound_compressor.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_mk_unfold.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_unfold.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_mk_unfold.cpp.o.d"
+  "/root/repo/src/muz/transforms/dl_transforms.cpp" "src/muz/transforms/CMakeFiles/transforms.dir/dl_transforms.cpp.o" "gcc" "src/muz/transforms/CMakeFiles/transforms.dir/dl_transforms.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,57 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/transforms.dir/dl_mk_array_blast.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_array_blast.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_array_eq_rewrite.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_array_eq_rewrite.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_array_instantiation.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_array_instantiation.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_backwards.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_backwards.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_bit_blast.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_bit_blast.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_coalesce.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_coalesce.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_coi_filter.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_coi_filter.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_elim_term_ite.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_elim_term_ite.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_filter_rules.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_filter_rules.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_interp_tail_simplifier.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_interp_tail_simplifier.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_karr_invariants.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_karr_invariants.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_loop_counter.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_loop_counter.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_magic_sets.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_magic_sets.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_magic_symbolic.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_magic_symbolic.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_quantifier_abstraction.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_quantifier_abstraction.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_quantifier_instantiation.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_quantifier_instantiation.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_rule_inliner.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_rule_inliner.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_scale.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_scale.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_separate_negated_tails.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_separate_negated_tails.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_slice.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_slice.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_subsumption_checker.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_subsumption_checker.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_synchronize.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_synchronize.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_unbound_compressor.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_unbound_compressor.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_mk_unfold.cpp.o"
+  "CMakeFiles/transforms.dir/dl_mk_unfold.cpp.o.d"
+  "CMakeFiles/transforms.dir/dl_transforms.cpp.o"
+  "CMakeFiles/transforms.dir/dl_transforms.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/transforms.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
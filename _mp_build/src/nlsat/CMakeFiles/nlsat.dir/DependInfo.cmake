@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/nlsat/nlsat_clause.cpp" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_clause.cpp.o" "gcc" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_clause.cpp.o.d"
+  "/root/repo/src/nlsat/nlsat_evaluator.cpp" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_evaluator.cpp.o" "gcc" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_evaluator.cpp.o.d"
+  "/root/repo/src/nlsat/nlsat_explain.cpp" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_explain.cpp.o" "gcc" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_explain.cpp.o.d"
+  "/root/repo/src/nlsat/nlsat_interval_set.cpp" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_interval_set.cpp.o" "gcc" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_interval_set.cpp.o.d"
+  "/root/repo/src/nlsat/nlsat_simple_checker.cpp" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_simple_checker.cpp.o" "gcc" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_simple_checker.cpp.o.d"
+  "/root/repo/src/nlsat/nlsat_simplify.cpp" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_simplify.cpp.o" "gcc" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_simplify.cpp.o.d"
+  "/root/repo/src/nlsat/nlsat_solver.cpp" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_solver.cpp.o" "gcc" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_solver.cpp.o.d"
+  "/root/repo/src/nlsat/nlsat_types.cpp" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_types.cpp.o" "gcc" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_types.cpp.o.d"
+  "/root/repo/src/nlsat/nlsat_variable_ordering_strategy.cpp" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_variable_ordering_strategy.cpp.o" "gcc" "src/nlsat/CMakeFiles/nlsat.dir/nlsat_variable_ordering_strategy.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,26 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nlsat.dir/nlsat_clause.cpp.o"
+  "CMakeFiles/nlsat.dir/nlsat_clause.cpp.o.d"
+  "CMakeFiles/nlsat.dir/nlsat_evaluator.cpp.o"
+  "CMakeFiles/nlsat.dir/nlsat_evaluator.cpp.o.d"
+  "CMakeFiles/nlsat.dir/nlsat_explain.cpp.o"
+  "CMakeFiles/nlsat.dir/nlsat_explain.cpp.o.d"
+  "CMakeFiles/nlsat.dir/nlsat_interval_set.cpp.o"
+  "CMakeFiles/nlsat.dir/nlsat_interval_set.cpp.o.d"
+  "CMakeFiles/nlsat.dir/nlsat_simple_checker.cpp.o"
+  "CMakeFiles/nlsat.dir/nlsat_simple_checker.cpp.o.d"
+  "CMakeFiles/nlsat.dir/nlsat_simplify.cpp.o"
+  "CMakeFiles/nlsat.dir/nlsat_simplify.cpp.o.d"
+  "CMakeFiles/nlsat.dir/nlsat_solver.cpp.o"
+  "CMakeFiles/nlsat.dir/nlsat_solver.cpp.o.d"
+  "CMakeFiles/nlsat.dir/nlsat_types.cpp.o"
+  "CMakeFiles/nlsat.dir/nlsat_types.cpp.o.d"
+  "CMakeFiles/nlsat.dir/nlsat_variable_ordering_strategy.cpp.o"
+  "CMakeFiles/nlsat.dir/nlsat_variable_ordering_strategy.cpp.o.d"
+  "nlsat_params.hpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nlsat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
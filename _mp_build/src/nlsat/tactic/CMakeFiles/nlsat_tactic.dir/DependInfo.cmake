@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/nlsat/tactic/goal2nlsat.cpp" "src/nlsat/tactic/CMakeFiles/nlsat_tactic.dir/goal2nlsat.cpp.o" "gcc" "src/nlsat/tactic/CMakeFiles/nlsat_tactic.dir/goal2nlsat.cpp.o.d"
+  "/root/repo/src/nlsat/tactic/nlsat_tactic.cpp" "src/nlsat/tactic/CMakeFiles/nlsat_tactic.dir/nlsat_tactic.cpp.o" "gcc" "src/nlsat/tactic/CMakeFiles/nlsat_tactic.dir/nlsat_tactic.cpp.o.d"
+  "/root/repo/src/nlsat/tactic/qfnra_nlsat_tactic.cpp" "src/nlsat/tactic/CMakeFiles/nlsat_tactic.dir/qfnra_nlsat_tactic.cpp.o" "gcc" "src/nlsat/tactic/CMakeFiles/nlsat_tactic.dir/qfnra_nlsat_tactic.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
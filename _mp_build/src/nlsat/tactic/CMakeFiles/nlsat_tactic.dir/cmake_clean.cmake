@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nlsat_tactic.dir/goal2nlsat.cpp.o"
+  "CMakeFiles/nlsat_tactic.dir/goal2nlsat.cpp.o.d"
+  "CMakeFiles/nlsat_tactic.dir/nlsat_tactic.cpp.o"
+  "CMakeFiles/nlsat_tactic.dir/nlsat_tactic.cpp.o.d"
+  "CMakeFiles/nlsat_tactic.dir/qfnra_nlsat_tactic.cpp.o"
+  "CMakeFiles/nlsat_tactic.dir/qfnra_nlsat_tactic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nlsat_tactic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
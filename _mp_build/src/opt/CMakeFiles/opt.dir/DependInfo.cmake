@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/opt/maxcore.cpp" "src/opt/CMakeFiles/opt.dir/maxcore.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/maxcore.cpp.o.d"
+  "/root/repo/src/opt/maxlex.cpp" "src/opt/CMakeFiles/opt.dir/maxlex.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/maxlex.cpp.o.d"
+  "/root/repo/src/opt/maxsmt.cpp" "src/opt/CMakeFiles/opt.dir/maxsmt.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/maxsmt.cpp.o.d"
+  "/root/repo/src/opt/opt_cmds.cpp" "src/opt/CMakeFiles/opt.dir/opt_cmds.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/opt_cmds.cpp.o.d"
+  "/root/repo/src/opt/opt_context.cpp" "src/opt/CMakeFiles/opt.dir/opt_context.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/opt_context.cpp.o.d"
+  "/root/repo/src/opt/opt_cores.cpp" "src/opt/CMakeFiles/opt.dir/opt_cores.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/opt_cores.cpp.o.d"
+  "/root/repo/src/opt/opt_lns.cpp" "src/opt/CMakeFiles/opt.dir/opt_lns.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/opt_lns.cpp.o.d"
+  "/root/repo/src/opt/opt_parallel_cores.cpp" "src/opt/CMakeFiles/opt.dir/opt_parallel_cores.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/opt_parallel_cores.cpp.o.d"
+  "/root/repo/src/opt/opt_pareto.cpp" "src/opt/CMakeFiles/opt.dir/opt_pareto.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/opt_pareto.cpp.o.d"
+  "/root/repo/src/opt/opt_parse.cpp" "src/opt/CMakeFiles/opt.dir/opt_parse.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/opt_parse.cpp.o.d"
+  "/root/repo/src/opt/opt_preprocess.cpp" "src/opt/CMakeFiles/opt.dir/opt_preprocess.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/opt_preprocess.cpp.o.d"
+  "/root/repo/src/opt/opt_solver.cpp" "src/opt/CMakeFiles/opt.dir/opt_solver.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/opt_solver.cpp.o.d"
+  "/root/repo/src/opt/optsmt.cpp" "src/opt/CMakeFiles/opt.dir/optsmt.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/optsmt.cpp.o.d"
+  "/root/repo/src/opt/pb_sls.cpp" "src/opt/CMakeFiles/opt.dir/pb_sls.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/pb_sls.cpp.o.d"
+  "/root/repo/src/opt/sortmax.cpp" "src/opt/CMakeFiles/opt.dir/sortmax.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/sortmax.cpp.o.d"
+  "/root/repo/src/opt/totalizer.cpp" "src/opt/CMakeFiles/opt.dir/totalizer.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/totalizer.cpp.o.d"
+  "/root/repo/src/opt/wmax.cpp" "src/opt/CMakeFiles/opt.dir/wmax.cpp.o" "gcc" "src/opt/CMakeFiles/opt.dir/wmax.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,42 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/opt.dir/maxcore.cpp.o"
+  "CMakeFiles/opt.dir/maxcore.cpp.o.d"
+  "CMakeFiles/opt.dir/maxlex.cpp.o"
+  "CMakeFiles/opt.dir/maxlex.cpp.o.d"
+  "CMakeFiles/opt.dir/maxsmt.cpp.o"
+  "CMakeFiles/opt.dir/maxsmt.cpp.o.d"
+  "CMakeFiles/opt.dir/opt_cmds.cpp.o"
+  "CMakeFiles/opt.dir/opt_cmds.cpp.o.d"
+  "CMakeFiles/opt.dir/opt_context.cpp.o"
+  "CMakeFiles/opt.dir/opt_context.cpp.o.d"
+  "CMakeFiles/opt.dir/opt_cores.cpp.o"
+  "CMakeFiles/opt.dir/opt_cores.cpp.o.d"
+  "CMakeFiles/opt.dir/opt_lns.cpp.o"
+  "CMakeFiles/opt.dir/opt_lns.cpp.o.d"
+  "CMakeFiles/opt.dir/opt_parallel_cores.cpp.o"
+  "CMakeFiles/opt.dir/opt_parallel_cores.cpp.o.d"
+  "CMakeFiles/opt.dir/opt_pareto.cpp.o"
+  "CMakeFiles/opt.dir/opt_pareto.cpp.o.d"
+  "CMakeFiles/opt.dir/opt_parse.cpp.o"
+  "CMakeFiles/opt.dir/opt_parse.cpp.o.d"
+  "CMakeFiles/opt.dir/opt_preprocess.cpp.o"
+  "CMakeFiles/opt.dir/opt_preprocess.cpp.o.d"
+  "CMakeFiles/opt.dir/opt_solver.cpp.o"
+  "CMakeFiles/opt.dir/opt_solver.cpp.o.d"
+  "CMakeFiles/opt.dir/optsmt.cpp.o"
+  "CMakeFiles/opt.dir/optsmt.cpp.o.d"
+  "CMakeFiles/opt.dir/pb_sls.cpp.o"
+  "CMakeFiles/opt.dir/pb_sls.cpp.o.d"
+  "CMakeFiles/opt.dir/sortmax.cpp.o"
+  "CMakeFiles/opt.dir/sortmax.cpp.o.d"
+  "CMakeFiles/opt.dir/totalizer.cpp.o"
+  "CMakeFiles/opt.dir/totalizer.cpp.o.d"
+  "CMakeFiles/opt.dir/wmax.cpp.o"
+  "CMakeFiles/opt.dir/wmax.cpp.o.d"
+  "opt_params.hpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/params.dir/context_params.cpp.o"
+  "CMakeFiles/params.dir/context_params.cpp.o.d"
+  "CMakeFiles/params.dir/pattern_inference_params.cpp.o"
+  "CMakeFiles/params.dir/pattern_inference_params.cpp.o.d"
+  "arith_rewriter_params.hpp"
+  "array_rewriter_params.hpp"
+  "bool_rewriter_params.hpp"
+  "bv_rewriter_params.hpp"
+  "fpa2bv_rewriter_params.hpp"
+  "fpa_rewriter_params.hpp"
+  "pattern_inference_params_helper.hpp"
+  "poly_rewriter_params.hpp"
+  "rewriter_params.hpp"
+  "sat_params.hpp"
+  "seq_rewriter_params.hpp"
+  "sls_params.hpp"
+  "solver_params.hpp"
+  "tactic_params.hpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/params.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
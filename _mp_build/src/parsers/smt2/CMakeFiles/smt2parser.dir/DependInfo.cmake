@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/parsers/smt2/marshal.cpp" "src/parsers/smt2/CMakeFiles/smt2parser.dir/marshal.cpp.o" "gcc" "src/parsers/smt2/CMakeFiles/smt2parser.dir/marshal.cpp.o.d"
+  "/root/repo/src/parsers/smt2/smt2parser.cpp" "src/parsers/smt2/CMakeFiles/smt2parser.dir/smt2parser.cpp.o" "gcc" "src/parsers/smt2/CMakeFiles/smt2parser.dir/smt2parser.cpp.o.d"
+  "/root/repo/src/parsers/smt2/smt2scanner.cpp" "src/parsers/smt2/CMakeFiles/smt2parser.dir/smt2scanner.cpp.o" "gcc" "src/parsers/smt2/CMakeFiles/smt2parser.dir/smt2scanner.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smt2parser.dir/marshal.cpp.o"
+  "CMakeFiles/smt2parser.dir/marshal.cpp.o.d"
+  "CMakeFiles/smt2parser.dir/smt2parser.cpp.o"
+  "CMakeFiles/smt2parser.dir/smt2parser.cpp.o.d"
+  "CMakeFiles/smt2parser.dir/smt2scanner.cpp.o"
+  "CMakeFiles/smt2parser.dir/smt2scanner.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smt2parser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/parsers/util/cost_parser.cpp" "src/parsers/util/CMakeFiles/parser_util.dir/cost_parser.cpp.o" "gcc" "src/parsers/util/CMakeFiles/parser_util.dir/cost_parser.cpp.o.d"
+  "/root/repo/src/parsers/util/pattern_validation.cpp" "src/parsers/util/CMakeFiles/parser_util.dir/pattern_validation.cpp.o" "gcc" "src/parsers/util/CMakeFiles/parser_util.dir/pattern_validation.cpp.o.d"
+  "/root/repo/src/parsers/util/scanner.cpp" "src/parsers/util/CMakeFiles/parser_util.dir/scanner.cpp.o" "gcc" "src/parsers/util/CMakeFiles/parser_util.dir/scanner.cpp.o.d"
+  "/root/repo/src/parsers/util/simple_parser.cpp" "src/parsers/util/CMakeFiles/parser_util.dir/simple_parser.cpp.o" "gcc" "src/parsers/util/CMakeFiles/parser_util.dir/simple_parser.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
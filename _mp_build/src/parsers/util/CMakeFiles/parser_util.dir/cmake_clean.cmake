@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parser_util.dir/cost_parser.cpp.o"
+  "CMakeFiles/parser_util.dir/cost_parser.cpp.o.d"
+  "CMakeFiles/parser_util.dir/pattern_validation.cpp.o"
+  "CMakeFiles/parser_util.dir/pattern_validation.cpp.o.d"
+  "CMakeFiles/parser_util.dir/scanner.cpp.o"
+  "CMakeFiles/parser_util.dir/scanner.cpp.o.d"
+  "CMakeFiles/parser_util.dir/simple_parser.cpp.o"
+  "CMakeFiles/parser_util.dir/simple_parser.cpp.o.d"
+  "parser_params.hpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parser_util.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/qe/nlarith_util.cpp" "src/qe/CMakeFiles/qe.dir/nlarith_util.cpp.o" "gcc" "src/qe/CMakeFiles/qe.dir/nlarith_util.cpp.o.d"
+  "/root/repo/src/qe/nlqsat.cpp" "src/qe/CMakeFiles/qe.dir/nlqsat.cpp.o" "gcc" "src/qe/CMakeFiles/qe.dir/nlqsat.cpp.o.d"
+  "/root/repo/src/qe/qe.cpp" "src/qe/CMakeFiles/qe.dir/qe.cpp.o" "gcc" "src/qe/CMakeFiles/qe.dir/qe.cpp.o.d"
+  "/root/repo/src/qe/qe_arith_plugin.cpp" "src/qe/CMakeFiles/qe.dir/qe_arith_plugin.cpp.o" "gcc" "src/qe/CMakeFiles/qe.dir/qe_arith_plugin.cpp.o.d"
+  "/root/repo/src/qe/qe_array_plugin.cpp" "src/qe/CMakeFiles/qe.dir/qe_array_plugin.cpp.o" "gcc" "src/qe/CMakeFiles/qe.dir/qe_array_plugin.cpp.o.d"
+  "/root/repo/src/qe/qe_bool_plugin.cpp" "src/qe/CMakeFiles/qe.dir/qe_bool_plugin.cpp.o" "gcc" "src/qe/CMakeFiles/qe.dir/qe_bool_plugin.cpp.o.d"
+  "/root/repo/src/qe/qe_bv_plugin.cpp" "src/qe/CMakeFiles/qe.dir/qe_bv_plugin.cpp.o" "gcc" "src/qe/CMakeFiles/qe.dir/qe_bv_plugin.cpp.o.d"
+  "/root/repo/src/qe/qe_cmd.cpp" "src/qe/CMakeFiles/qe.dir/qe_cmd.cpp.o" "gcc" "src/qe/CMakeFiles/qe.dir/qe_cmd.cpp.o.d"
+  "/root/repo/src/qe/qe_datatype_plugin.cpp" "src/qe/CMakeFiles/qe.dir/qe_datatype_plugin.cpp.o" "gcc" "src/qe/CMakeFiles/qe.dir/qe_datatype_plugin.cpp.o.d"
+  "/root/repo/src/qe/qe_dl_plugin.cpp" "src/qe/CMakeFiles/qe.dir/qe_dl_plugin.cpp.o" "gcc" "src/qe/CMakeFiles/qe.dir/qe_dl_plugin.cpp.o.d"
+  "/root/repo/src/qe/qe_mbi.cpp" "src/qe/CMakeFiles/qe.dir/qe_mbi.cpp.o" "gcc" "src/qe/CMakeFiles/qe.dir/qe_mbi.cpp.o.d"
+  "/root/repo/src/qe/qe_mbp.cpp" "src/qe/CMakeFiles/qe.dir/qe_mbp.cpp.o" "gcc" "src/qe/CMakeFiles/qe.dir/qe_mbp.cpp.o.d"
+  "/root/repo/src/qe/qe_tactic.cpp" "src/qe/CMakeFiles/qe.dir/qe_tactic.cpp.o" "gcc" "src/qe/CMakeFiles/qe.dir/qe_tactic.cpp.o.d"
+  "/root/repo/src/qe/qsat.cpp" "src/qe/CMakeFiles/qe.dir/qsat.cpp.o" "gcc" "src/qe/CMakeFiles/qe.dir/qsat.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
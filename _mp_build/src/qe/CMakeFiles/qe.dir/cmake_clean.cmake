@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qe.dir/nlarith_util.cpp.o"
+  "CMakeFiles/qe.dir/nlarith_util.cpp.o.d"
+  "CMakeFiles/qe.dir/nlqsat.cpp.o"
+  "CMakeFiles/qe.dir/nlqsat.cpp.o.d"
+  "CMakeFiles/qe.dir/qe.cpp.o"
+  "CMakeFiles/qe.dir/qe.cpp.o.d"
+  "CMakeFiles/qe.dir/qe_arith_plugin.cpp.o"
+  "CMakeFiles/qe.dir/qe_arith_plugin.cpp.o.d"
+  "CMakeFiles/qe.dir/qe_array_plugin.cpp.o"
+  "CMakeFiles/qe.dir/qe_array_plugin.cpp.o.d"
+  "CMakeFiles/qe.dir/qe_bool_plugin.cpp.o"
+  "CMakeFiles/qe.dir/qe_bool_plugin.cpp.o.d"
+  "CMakeFiles/qe.dir/qe_bv_plugin.cpp.o"
+  "CMakeFiles/qe.dir/qe_bv_plugin.cpp.o.d"
+  "CMakeFiles/qe.dir/qe_cmd.cpp.o"
+  "CMakeFiles/qe.dir/qe_cmd.cpp.o.d"
+  "CMakeFiles/qe.dir/qe_datatype_plugin.cpp.o"
+  "CMakeFiles/qe.dir/qe_datatype_plugin.cpp.o.d"
+  "CMakeFiles/qe.dir/qe_dl_plugin.cpp.o"
+  "CMakeFiles/qe.dir/qe_dl_plugin.cpp.o.d"
+  "CMakeFiles/qe.dir/qe_mbi.cpp.o"
+  "CMakeFiles/qe.dir/qe_mbi.cpp.o.d"
+  "CMakeFiles/qe.dir/qe_mbp.cpp.o"
+  "CMakeFiles/qe.dir/qe_mbp.cpp.o.d"
+  "CMakeFiles/qe.dir/qe_tactic.cpp.o"
+  "CMakeFiles/qe.dir/qe_tactic.cpp.o.d"
+  "CMakeFiles/qe.dir/qsat.cpp.o"
+  "CMakeFiles/qe.dir/qsat.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qe.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
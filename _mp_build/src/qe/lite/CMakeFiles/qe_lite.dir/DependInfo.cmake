@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/qe/lite/qe_lite_tactic.cpp" "src/qe/lite/CMakeFiles/qe_lite.dir/qe_lite_tactic.cpp.o" "gcc" "src/qe/lite/CMakeFiles/qe_lite.dir/qe_lite_tactic.cpp.o.d"
+  "/root/repo/src/qe/lite/qel.cpp" "src/qe/lite/CMakeFiles/qe_lite.dir/qel.cpp.o" "gcc" "src/qe/lite/CMakeFiles/qe_lite.dir/qel.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
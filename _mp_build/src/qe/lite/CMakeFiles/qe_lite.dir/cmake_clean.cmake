@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qe_lite.dir/qe_lite_tactic.cpp.o"
+  "CMakeFiles/qe_lite.dir/qe_lite_tactic.cpp.o.d"
+  "CMakeFiles/qe_lite.dir/qel.cpp.o"
+  "CMakeFiles/qe_lite.dir/qel.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qe_lite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
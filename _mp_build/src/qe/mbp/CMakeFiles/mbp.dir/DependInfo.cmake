@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/qe/mbp/mbp_arith.cpp" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_arith.cpp.o" "gcc" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_arith.cpp.o.d"
+  "/root/repo/src/qe/mbp/mbp_arrays.cpp" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_arrays.cpp.o" "gcc" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_arrays.cpp.o.d"
+  "/root/repo/src/qe/mbp/mbp_arrays_tg.cpp" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_arrays_tg.cpp.o" "gcc" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_arrays_tg.cpp.o.d"
+  "/root/repo/src/qe/mbp/mbp_basic_tg.cpp" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_basic_tg.cpp.o" "gcc" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_basic_tg.cpp.o.d"
+  "/root/repo/src/qe/mbp/mbp_datatypes.cpp" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_datatypes.cpp.o" "gcc" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_datatypes.cpp.o.d"
+  "/root/repo/src/qe/mbp/mbp_dt_tg.cpp" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_dt_tg.cpp.o" "gcc" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_dt_tg.cpp.o.d"
+  "/root/repo/src/qe/mbp/mbp_euf.cpp" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_euf.cpp.o" "gcc" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_euf.cpp.o.d"
+  "/root/repo/src/qe/mbp/mbp_plugin.cpp" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_plugin.cpp.o" "gcc" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_plugin.cpp.o.d"
+  "/root/repo/src/qe/mbp/mbp_qel.cpp" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_qel.cpp.o" "gcc" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_qel.cpp.o.d"
+  "/root/repo/src/qe/mbp/mbp_qel_util.cpp" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_qel_util.cpp.o" "gcc" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_qel_util.cpp.o.d"
+  "/root/repo/src/qe/mbp/mbp_solve_plugin.cpp" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_solve_plugin.cpp.o" "gcc" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_solve_plugin.cpp.o.d"
+  "/root/repo/src/qe/mbp/mbp_term_graph.cpp" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_term_graph.cpp.o" "gcc" "src/qe/mbp/CMakeFiles/mbp.dir/mbp_term_graph.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mbp.dir/mbp_arith.cpp.o"
+  "CMakeFiles/mbp.dir/mbp_arith.cpp.o.d"
+  "CMakeFiles/mbp.dir/mbp_arrays.cpp.o"
+  "CMakeFiles/mbp.dir/mbp_arrays.cpp.o.d"
+  "CMakeFiles/mbp.dir/mbp_arrays_tg.cpp.o"
+  "CMakeFiles/mbp.dir/mbp_arrays_tg.cpp.o.d"
+  "CMakeFiles/mbp.dir/mbp_basic_tg.cpp.o"
+  "CMakeFiles/mbp.dir/mbp_basic_tg.cpp.o.d"
+  "CMakeFiles/mbp.dir/mbp_datatypes.cpp.o"
+  "CMakeFiles/mbp.dir/mbp_datatypes.cpp.o.d"
+  "CMakeFiles/mbp.dir/mbp_dt_tg.cpp.o"
+  "CMakeFiles/mbp.dir/mbp_dt_tg.cpp.o.d"
+  "CMakeFiles/mbp.dir/mbp_euf.cpp.o"
+  "CMakeFiles/mbp.dir/mbp_euf.cpp.o.d"
+  "CMakeFiles/mbp.dir/mbp_plugin.cpp.o"
+  "CMakeFiles/mbp.dir/mbp_plugin.cpp.o.d"
+  "CMakeFiles/mbp.dir/mbp_qel.cpp.o"
+  "CMakeFiles/mbp.dir/mbp_qel.cpp.o.d"
+  "CMakeFiles/mbp.dir/mbp_qel_util.cpp.o"
+  "CMakeFiles/mbp.dir/mbp_qel_util.cpp.o.d"
+  "CMakeFiles/mbp.dir/mbp_solve_plugin.cpp.o"
+  "CMakeFiles/mbp.dir/mbp_solve_plugin.cpp.o.d"
+  "CMakeFiles/mbp.dir/mbp_term_graph.cpp.o"
+  "CMakeFiles/mbp.dir/mbp_term_graph.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mbp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
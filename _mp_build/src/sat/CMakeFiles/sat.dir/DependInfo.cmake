@@ -0,0 +1,54 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/sat/dimacs.cpp" "src/sat/CMakeFiles/sat.dir/dimacs.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/dimacs.cpp.o.d"
+  "/root/repo/src/sat/sat_aig_cuts.cpp" "src/sat/CMakeFiles/sat.dir/sat_aig_cuts.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_aig_cuts.cpp.o.d"
+  "/root/repo/src/sat/sat_aig_finder.cpp" "src/sat/CMakeFiles/sat.dir/sat_aig_finder.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_aig_finder.cpp.o.d"
+  "/root/repo/src/sat/sat_anf_simplifier.cpp" "src/sat/CMakeFiles/sat.dir/sat_anf_simplifier.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_anf_simplifier.cpp.o.d"
+  "/root/repo/src/sat/sat_asymm_branch.cpp" "src/sat/CMakeFiles/sat.dir/sat_asymm_branch.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_asymm_branch.cpp.o.d"
+  "/root/repo/src/sat/sat_bcd.cpp" "src/sat/CMakeFiles/sat.dir/sat_bcd.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_bcd.cpp.o.d"
+  "/root/repo/src/sat/sat_big.cpp" "src/sat/CMakeFiles/sat.dir/sat_big.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_big.cpp.o.d"
+  "/root/repo/src/sat/sat_circuit.cpp" "src/sat/CMakeFiles/sat.dir/sat_circuit.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_circuit.cpp.o.d"
+  "/root/repo/src/sat/sat_clause.cpp" "src/sat/CMakeFiles/sat.dir/sat_clause.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_clause.cpp.o.d"
+  "/root/repo/src/sat/sat_clause_set.cpp" "src/sat/CMakeFiles/sat.dir/sat_clause_set.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_clause_set.cpp.o.d"
+  "/root/repo/src/sat/sat_clause_use_list.cpp" "src/sat/CMakeFiles/sat.dir/sat_clause_use_list.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_clause_use_list.cpp.o.d"
+  "/root/repo/src/sat/sat_cleaner.cpp" "src/sat/CMakeFiles/sat.dir/sat_cleaner.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_cleaner.cpp.o.d"
+  "/root/repo/src/sat/sat_config.cpp" "src/sat/CMakeFiles/sat.dir/sat_config.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_config.cpp.o.d"
+  "/root/repo/src/sat/sat_cut_simplifier.cpp" "src/sat/CMakeFiles/sat.dir/sat_cut_simplifier.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_cut_simplifier.cpp.o.d"
+  "/root/repo/src/sat/sat_cutset.cpp" "src/sat/CMakeFiles/sat.dir/sat_cutset.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_cutset.cpp.o.d"
+  "/root/repo/src/sat/sat_ddfw_wrapper.cpp" "src/sat/CMakeFiles/sat.dir/sat_ddfw_wrapper.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_ddfw_wrapper.cpp.o.d"
+  "/root/repo/src/sat/sat_drat.cpp" "src/sat/CMakeFiles/sat.dir/sat_drat.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_drat.cpp.o.d"
+  "/root/repo/src/sat/sat_elim_eqs.cpp" "src/sat/CMakeFiles/sat.dir/sat_elim_eqs.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_elim_eqs.cpp.o.d"
+  "/root/repo/src/sat/sat_elim_vars.cpp" "src/sat/CMakeFiles/sat.dir/sat_elim_vars.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_elim_vars.cpp.o.d"
+  "/root/repo/src/sat/sat_gc.cpp" "src/sat/CMakeFiles/sat.dir/sat_gc.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_gc.cpp.o.d"
+  "/root/repo/src/sat/sat_integrity_checker.cpp" "src/sat/CMakeFiles/sat.dir/sat_integrity_checker.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_integrity_checker.cpp.o.d"
+  "/root/repo/src/sat/sat_local_search.cpp" "src/sat/CMakeFiles/sat.dir/sat_local_search.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_local_search.cpp.o.d"
+  "/root/repo/src/sat/sat_lookahead.cpp" "src/sat/CMakeFiles/sat.dir/sat_lookahead.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_lookahead.cpp.o.d"
+  "/root/repo/src/sat/sat_lut_finder.cpp" "src/sat/CMakeFiles/sat.dir/sat_lut_finder.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_lut_finder.cpp.o.d"
+  "/root/repo/src/sat/sat_model_converter.cpp" "src/sat/CMakeFiles/sat.dir/sat_model_converter.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_model_converter.cpp.o.d"
+  "/root/repo/src/sat/sat_mus.cpp" "src/sat/CMakeFiles/sat.dir/sat_mus.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_mus.cpp.o.d"
+  "/root/repo/src/sat/sat_npn3_finder.cpp" "src/sat/CMakeFiles/sat.dir/sat_npn3_finder.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_npn3_finder.cpp.o.d"
+  "/root/repo/src/sat/sat_parallel.cpp" "src/sat/CMakeFiles/sat.dir/sat_parallel.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_parallel.cpp.o.d"
+  "/root/repo/src/sat/sat_prob.cpp" "src/sat/CMakeFiles/sat.dir/sat_prob.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_prob.cpp.o.d"
+  "/root/repo/src/sat/sat_probing.cpp" "src/sat/CMakeFiles/sat.dir/sat_probing.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_probing.cpp.o.d"
+  "/root/repo/src/sat/sat_proof_trim.cpp" "src/sat/CMakeFiles/sat.dir/sat_proof_trim.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_proof_trim.cpp.o.d"
+  "/root/repo/src/sat/sat_scc.cpp" "src/sat/CMakeFiles/sat.dir/sat_scc.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_scc.cpp.o.d"
+  "/root/repo/src/sat/sat_simplifier.cpp" "src/sat/CMakeFiles/sat.dir/sat_simplifier.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_simplifier.cpp.o.d"
+  "/root/repo/src/sat/sat_solver.cpp" "src/sat/CMakeFiles/sat.dir/sat_solver.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_solver.cpp.o.d"
+  "/root/repo/src/sat/sat_watched.cpp" "src/sat/CMakeFiles/sat.dir/sat_watched.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_watched.cpp.o.d"
+  "/root/repo/src/sat/sat_xor_finder.cpp" "src/sat/CMakeFiles/sat.dir/sat_xor_finder.cpp.o" "gcc" "src/sat/CMakeFiles/sat.dir/sat_xor_finder.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,82 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sat.dir/dimacs.cpp.o"
+  "CMakeFiles/sat.dir/dimacs.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_aig_cuts.cpp.o"
+  "CMakeFiles/sat.dir/sat_aig_cuts.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_aig_finder.cpp.o"
+  "CMakeFiles/sat.dir/sat_aig_finder.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_anf_simplifier.cpp.o"
+  "CMakeFiles/sat.dir/sat_anf_simplifier.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_asymm_branch.cpp.o"
+  "CMakeFiles/sat.dir/sat_asymm_branch.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_bcd.cpp.o"
+  "CMakeFiles/sat.dir/sat_bcd.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_big.cpp.o"
+  "CMakeFiles/sat.dir/sat_big.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_circuit.cpp.o"
+  "CMakeFiles/sat.dir/sat_circuit.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_clause.cpp.o"
+  "CMakeFiles/sat.dir/sat_clause.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_clause_set.cpp.o"
+  "CMakeFiles/sat.dir/sat_clause_set.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_clause_use_list.cpp.o"
+  "CMakeFiles/sat.dir/sat_clause_use_list.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_cleaner.cpp.o"
+  "CMakeFiles/sat.dir/sat_cleaner.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_config.cpp.o"
+  "CMakeFiles/sat.dir/sat_config.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_cut_simplifier.cpp.o"
+  "CMakeFiles/sat.dir/sat_cut_simplifier.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_cutset.cpp.o"
+  "CMakeFiles/sat.dir/sat_cutset.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_ddfw_wrapper.cpp.o"
+  "CMakeFiles/sat.dir/sat_ddfw_wrapper.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_drat.cpp.o"
+  "CMakeFiles/sat.dir/sat_drat.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_elim_eqs.cpp.o"
+  "CMakeFiles/sat.dir/sat_elim_eqs.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_elim_vars.cpp.o"
+  "CMakeFiles/sat.dir/sat_elim_vars.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_gc.cpp.o"
+  "CMakeFiles/sat.dir/sat_gc.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_integrity_checker.cpp.o"
+  "CMakeFiles/sat.dir/sat_integrity_checker.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_local_search.cpp.o"
+  "CMakeFiles/sat.dir/sat_local_search.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_lookahead.cpp.o"
+  "CMakeFiles/sat.dir/sat_lookahead.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_lut_finder.cpp.o"
+  "CMakeFiles/sat.dir/sat_lut_finder.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_model_converter.cpp.o"
+  "CMakeFiles/sat.dir/sat_model_converter.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_mus.cpp.o"
+  "CMakeFiles/sat.dir/sat_mus.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_npn3_finder.cpp.o"
+  "CMakeFiles/sat.dir/sat_npn3_finder.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_parallel.cpp.o"
+  "CMakeFiles/sat.dir/sat_parallel.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_prob.cpp.o"
+  "CMakeFiles/sat.dir/sat_prob.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_probing.cpp.o"
+  "CMakeFiles/sat.dir/sat_probing.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_proof_trim.cpp.o"
+  "CMakeFiles/sat.dir/sat_proof_trim.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_scc.cpp.o"
+  "CMakeFiles/sat.dir/sat_scc.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_simplifier.cpp.o"
+  "CMakeFiles/sat.dir/sat_simplifier.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_solver.cpp.o"
+  "CMakeFiles/sat.dir/sat_solver.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_watched.cpp.o"
+  "CMakeFiles/sat.dir/sat_watched.cpp.o.d"
+  "CMakeFiles/sat.dir/sat_xor_finder.cpp.o"
+  "CMakeFiles/sat.dir/sat_xor_finder.cpp.o.d"
+  "sat_asymm_branch_params.hpp"
+  "sat_scc_params.hpp"
+  "sat_simplifier_params.hpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
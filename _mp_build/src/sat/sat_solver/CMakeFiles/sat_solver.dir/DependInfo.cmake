@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/sat/sat_solver/inc_sat_solver.cpp" "src/sat/sat_solver/CMakeFiles/sat_solver.dir/inc_sat_solver.cpp.o" "gcc" "src/sat/sat_solver/CMakeFiles/sat_solver.dir/inc_sat_solver.cpp.o.d"
+  "/root/repo/src/sat/sat_solver/sat_smt_solver.cpp" "src/sat/sat_solver/CMakeFiles/sat_solver.dir/sat_smt_solver.cpp.o" "gcc" "src/sat/sat_solver/CMakeFiles/sat_solver.dir/sat_smt_solver.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
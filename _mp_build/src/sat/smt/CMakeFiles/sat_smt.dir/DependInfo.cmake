@@ -0,0 +1,67 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/sat/smt/arith_axioms.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/arith_axioms.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/arith_axioms.cpp.o.d"
+  "/root/repo/src/sat/smt/arith_diagnostics.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/arith_diagnostics.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/arith_diagnostics.cpp.o.d"
+  "/root/repo/src/sat/smt/arith_internalize.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/arith_internalize.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/arith_internalize.cpp.o.d"
+  "/root/repo/src/sat/smt/arith_solver.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/arith_solver.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/arith_solver.cpp.o.d"
+  "/root/repo/src/sat/smt/arith_value.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/arith_value.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/arith_value.cpp.o.d"
+  "/root/repo/src/sat/smt/array_axioms.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/array_axioms.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/array_axioms.cpp.o.d"
+  "/root/repo/src/sat/smt/array_diagnostics.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/array_diagnostics.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/array_diagnostics.cpp.o.d"
+  "/root/repo/src/sat/smt/array_internalize.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/array_internalize.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/array_internalize.cpp.o.d"
+  "/root/repo/src/sat/smt/array_model.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/array_model.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/array_model.cpp.o.d"
+  "/root/repo/src/sat/smt/array_solver.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/array_solver.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/array_solver.cpp.o.d"
+  "/root/repo/src/sat/smt/atom2bool_var.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/atom2bool_var.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/atom2bool_var.cpp.o.d"
+  "/root/repo/src/sat/smt/bv_ackerman.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/bv_ackerman.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/bv_ackerman.cpp.o.d"
+  "/root/repo/src/sat/smt/bv_delay_internalize.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/bv_delay_internalize.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/bv_delay_internalize.cpp.o.d"
+  "/root/repo/src/sat/smt/bv_internalize.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/bv_internalize.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/bv_internalize.cpp.o.d"
+  "/root/repo/src/sat/smt/bv_invariant.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/bv_invariant.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/bv_invariant.cpp.o.d"
+  "/root/repo/src/sat/smt/bv_solver.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/bv_solver.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/bv_solver.cpp.o.d"
+  "/root/repo/src/sat/smt/bv_theory_checker.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/bv_theory_checker.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/bv_theory_checker.cpp.o.d"
+  "/root/repo/src/sat/smt/bv_word_propagate.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/bv_word_propagate.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/bv_word_propagate.cpp.o.d"
+  "/root/repo/src/sat/smt/dt_solver.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/dt_solver.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/dt_solver.cpp.o.d"
+  "/root/repo/src/sat/smt/euf_ackerman.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/euf_ackerman.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/euf_ackerman.cpp.o.d"
+  "/root/repo/src/sat/smt/euf_internalize.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/euf_internalize.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/euf_internalize.cpp.o.d"
+  "/root/repo/src/sat/smt/euf_invariant.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/euf_invariant.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/euf_invariant.cpp.o.d"
+  "/root/repo/src/sat/smt/euf_model.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/euf_model.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/euf_model.cpp.o.d"
+  "/root/repo/src/sat/smt/euf_proof.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/euf_proof.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/euf_proof.cpp.o.d"
+  "/root/repo/src/sat/smt/euf_proof_checker.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/euf_proof_checker.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/euf_proof_checker.cpp.o.d"
+  "/root/repo/src/sat/smt/euf_relevancy.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/euf_relevancy.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/euf_relevancy.cpp.o.d"
+  "/root/repo/src/sat/smt/euf_solver.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/euf_solver.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/euf_solver.cpp.o.d"
+  "/root/repo/src/sat/smt/fpa_solver.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/fpa_solver.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/fpa_solver.cpp.o.d"
+  "/root/repo/src/sat/smt/intblast_solver.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/intblast_solver.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/intblast_solver.cpp.o.d"
+  "/root/repo/src/sat/smt/pb_card.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/pb_card.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/pb_card.cpp.o.d"
+  "/root/repo/src/sat/smt/pb_constraint.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/pb_constraint.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/pb_constraint.cpp.o.d"
+  "/root/repo/src/sat/smt/pb_internalize.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/pb_internalize.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/pb_internalize.cpp.o.d"
+  "/root/repo/src/sat/smt/pb_pb.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/pb_pb.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/pb_pb.cpp.o.d"
+  "/root/repo/src/sat/smt/pb_solver.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/pb_solver.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/pb_solver.cpp.o.d"
+  "/root/repo/src/sat/smt/q_clause.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/q_clause.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/q_clause.cpp.o.d"
+  "/root/repo/src/sat/smt/q_ematch.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/q_ematch.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/q_ematch.cpp.o.d"
+  "/root/repo/src/sat/smt/q_eval.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/q_eval.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/q_eval.cpp.o.d"
+  "/root/repo/src/sat/smt/q_mam.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/q_mam.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/q_mam.cpp.o.d"
+  "/root/repo/src/sat/smt/q_mbi.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/q_mbi.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/q_mbi.cpp.o.d"
+  "/root/repo/src/sat/smt/q_model_fixer.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/q_model_fixer.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/q_model_fixer.cpp.o.d"
+  "/root/repo/src/sat/smt/q_queue.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/q_queue.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/q_queue.cpp.o.d"
+  "/root/repo/src/sat/smt/q_solver.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/q_solver.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/q_solver.cpp.o.d"
+  "/root/repo/src/sat/smt/q_theory_checker.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/q_theory_checker.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/q_theory_checker.cpp.o.d"
+  "/root/repo/src/sat/smt/recfun_solver.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/recfun_solver.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/recfun_solver.cpp.o.d"
+  "/root/repo/src/sat/smt/sat_th.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/sat_th.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/sat_th.cpp.o.d"
+  "/root/repo/src/sat/smt/sls_solver.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/sls_solver.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/sls_solver.cpp.o.d"
+  "/root/repo/src/sat/smt/specrel_solver.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/specrel_solver.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/specrel_solver.cpp.o.d"
+  "/root/repo/src/sat/smt/tseitin_theory_checker.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/tseitin_theory_checker.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/tseitin_theory_checker.cpp.o.d"
+  "/root/repo/src/sat/smt/user_solver.cpp" "src/sat/smt/CMakeFiles/sat_smt.dir/user_solver.cpp.o" "gcc" "src/sat/smt/CMakeFiles/sat_smt.dir/user_solver.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
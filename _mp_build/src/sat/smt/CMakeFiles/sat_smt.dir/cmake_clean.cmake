@@ -0,0 +1,105 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sat_smt.dir/arith_axioms.cpp.o"
+  "CMakeFiles/sat_smt.dir/arith_axioms.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/arith_diagnostics.cpp.o"
+  "CMakeFiles/sat_smt.dir/arith_diagnostics.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/arith_internalize.cpp.o"
+  "CMakeFiles/sat_smt.dir/arith_internalize.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/arith_solver.cpp.o"
+  "CMakeFiles/sat_smt.dir/arith_solver.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/arith_value.cpp.o"
+  "CMakeFiles/sat_smt.dir/arith_value.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/array_axioms.cpp.o"
+  "CMakeFiles/sat_smt.dir/array_axioms.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/array_diagnostics.cpp.o"
+  "CMakeFiles/sat_smt.dir/array_diagnostics.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/array_internalize.cpp.o"
+  "CMakeFiles/sat_smt.dir/array_internalize.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/array_model.cpp.o"
+  "CMakeFiles/sat_smt.dir/array_model.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/array_solver.cpp.o"
+  "CMakeFiles/sat_smt.dir/array_solver.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/atom2bool_var.cpp.o"
+  "CMakeFiles/sat_smt.dir/atom2bool_var.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/bv_ackerman.cpp.o"
+  "CMakeFiles/sat_smt.dir/bv_ackerman.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/bv_delay_internalize.cpp.o"
+  "CMakeFiles/sat_smt.dir/bv_delay_internalize.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/bv_internalize.cpp.o"
+  "CMakeFiles/sat_smt.dir/bv_internalize.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/bv_invariant.cpp.o"
+  "CMakeFiles/sat_smt.dir/bv_invariant.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/bv_solver.cpp.o"
+  "CMakeFiles/sat_smt.dir/bv_solver.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/bv_theory_checker.cpp.o"
+  "CMakeFiles/sat_smt.dir/bv_theory_checker.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/bv_word_propagate.cpp.o"
+  "CMakeFiles/sat_smt.dir/bv_word_propagate.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/dt_solver.cpp.o"
+  "CMakeFiles/sat_smt.dir/dt_solver.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/euf_ackerman.cpp.o"
+  "CMakeFiles/sat_smt.dir/euf_ackerman.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/euf_internalize.cpp.o"
+  "CMakeFiles/sat_smt.dir/euf_internalize.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/euf_invariant.cpp.o"
+  "CMakeFiles/sat_smt.dir/euf_invariant.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/euf_model.cpp.o"
+  "CMakeFiles/sat_smt.dir/euf_model.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/euf_proof.cpp.o"
+  "CMakeFiles/sat_smt.dir/euf_proof.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/euf_proof_checker.cpp.o"
+  "CMakeFiles/sat_smt.dir/euf_proof_checker.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/euf_relevancy.cpp.o"
+  "CMakeFiles/sat_smt.dir/euf_relevancy.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/euf_solver.cpp.o"
+  "CMakeFiles/sat_smt.dir/euf_solver.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/fpa_solver.cpp.o"
+  "CMakeFiles/sat_smt.dir/fpa_solver.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/intblast_solver.cpp.o"
+  "CMakeFiles/sat_smt.dir/intblast_solver.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/pb_card.cpp.o"
+  "CMakeFiles/sat_smt.dir/pb_card.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/pb_constraint.cpp.o"
+  "CMakeFiles/sat_smt.dir/pb_constraint.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/pb_internalize.cpp.o"
+  "CMakeFiles/sat_smt.dir/pb_internalize.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/pb_pb.cpp.o"
+  "CMakeFiles/sat_smt.dir/pb_pb.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/pb_solver.cpp.o"
+  "CMakeFiles/sat_smt.dir/pb_solver.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/q_clause.cpp.o"
+  "CMakeFiles/sat_smt.dir/q_clause.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/q_ematch.cpp.o"
+  "CMakeFiles/sat_smt.dir/q_ematch.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/q_eval.cpp.o"
+  "CMakeFiles/sat_smt.dir/q_eval.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/q_mam.cpp.o"
+  "CMakeFiles/sat_smt.dir/q_mam.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/q_mbi.cpp.o"
+  "CMakeFiles/sat_smt.dir/q_mbi.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/q_model_fixer.cpp.o"
+  "CMakeFiles/sat_smt.dir/q_model_fixer.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/q_queue.cpp.o"
+  "CMakeFiles/sat_smt.dir/q_queue.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/q_solver.cpp.o"
+  "CMakeFiles/sat_smt.dir/q_solver.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/q_theory_checker.cpp.o"
+  "CMakeFiles/sat_smt.dir/q_theory_checker.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/recfun_solver.cpp.o"
+  "CMakeFiles/sat_smt.dir/recfun_solver.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/sat_th.cpp.o"
+  "CMakeFiles/sat_smt.dir/sat_th.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/sls_solver.cpp.o"
+  "CMakeFiles/sat_smt.dir/sls_solver.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/specrel_solver.cpp.o"
+  "CMakeFiles/sat_smt.dir/specrel_solver.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/tseitin_theory_checker.cpp.o"
+  "CMakeFiles/sat_smt.dir/tseitin_theory_checker.cpp.o.d"
+  "CMakeFiles/sat_smt.dir/user_solver.cpp.o"
+  "CMakeFiles/sat_smt.dir/user_solver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sat_smt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
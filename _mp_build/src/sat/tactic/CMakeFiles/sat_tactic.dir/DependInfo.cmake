@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/sat/tactic/goal2sat.cpp" "src/sat/tactic/CMakeFiles/sat_tactic.dir/goal2sat.cpp.o" "gcc" "src/sat/tactic/CMakeFiles/sat_tactic.dir/goal2sat.cpp.o.d"
+  "/root/repo/src/sat/tactic/sat2goal.cpp" "src/sat/tactic/CMakeFiles/sat_tactic.dir/sat2goal.cpp.o" "gcc" "src/sat/tactic/CMakeFiles/sat_tactic.dir/sat2goal.cpp.o.d"
+  "/root/repo/src/sat/tactic/sat_tactic.cpp" "src/sat/tactic/CMakeFiles/sat_tactic.dir/sat_tactic.cpp.o" "gcc" "src/sat/tactic/CMakeFiles/sat_tactic.dir/sat_tactic.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sat_tactic.dir/goal2sat.cpp.o"
+  "CMakeFiles/sat_tactic.dir/goal2sat.cpp.o.d"
+  "CMakeFiles/sat_tactic.dir/sat2goal.cpp.o"
+  "CMakeFiles/sat_tactic.dir/sat2goal.cpp.o.d"
+  "CMakeFiles/sat_tactic.dir/sat_tactic.cpp.o"
+  "CMakeFiles/sat_tactic.dir/sat_tactic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sat_tactic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
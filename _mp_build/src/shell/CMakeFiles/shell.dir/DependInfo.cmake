@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/shell/datalog_frontend.cpp" "src/shell/CMakeFiles/shell.dir/datalog_frontend.cpp.o" "gcc" "src/shell/CMakeFiles/shell.dir/datalog_frontend.cpp.o.d"
+  "/root/repo/src/shell/dimacs_frontend.cpp" "src/shell/CMakeFiles/shell.dir/dimacs_frontend.cpp.o" "gcc" "src/shell/CMakeFiles/shell.dir/dimacs_frontend.cpp.o.d"
+  "/root/repo/src/shell/drat_frontend.cpp" "src/shell/CMakeFiles/shell.dir/drat_frontend.cpp.o" "gcc" "src/shell/CMakeFiles/shell.dir/drat_frontend.cpp.o.d"
+  "/root/repo/_mp_build/src/shell/gparams_register_modules.cpp" "src/shell/CMakeFiles/shell.dir/gparams_register_modules.cpp.o" "gcc" "src/shell/CMakeFiles/shell.dir/gparams_register_modules.cpp.o.d"
+  "/root/repo/_mp_build/src/shell/install_tactic.cpp" "src/shell/CMakeFiles/shell.dir/install_tactic.cpp.o" "gcc" "src/shell/CMakeFiles/shell.dir/install_tactic.cpp.o.d"
+  "/root/repo/src/shell/main.cpp" "src/shell/CMakeFiles/shell.dir/main.cpp.o" "gcc" "src/shell/CMakeFiles/shell.dir/main.cpp.o.d"
+  "/root/repo/_mp_build/src/shell/mem_initializer.cpp" "src/shell/CMakeFiles/shell.dir/mem_initializer.cpp.o" "gcc" "src/shell/CMakeFiles/shell.dir/mem_initializer.cpp.o.d"
+  "/root/repo/src/shell/opt_frontend.cpp" "src/shell/CMakeFiles/shell.dir/opt_frontend.cpp.o" "gcc" "src/shell/CMakeFiles/shell.dir/opt_frontend.cpp.o.d"
+  "/root/repo/src/shell/smtlib_frontend.cpp" "src/shell/CMakeFiles/shell.dir/smtlib_frontend.cpp.o" "gcc" "src/shell/CMakeFiles/shell.dir/smtlib_frontend.cpp.o.d"
+  "/root/repo/src/shell/z3_log_frontend.cpp" "src/shell/CMakeFiles/shell.dir/z3_log_frontend.cpp.o" "gcc" "src/shell/CMakeFiles/shell.dir/z3_log_frontend.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,32 @@
+file(REMOVE_RECURSE
+  "../../z3"
+  "../../z3.pdb"
+  "CMakeFiles/shell.dir/datalog_frontend.cpp.o"
+  "CMakeFiles/shell.dir/datalog_frontend.cpp.o.d"
+  "CMakeFiles/shell.dir/dimacs_frontend.cpp.o"
+  "CMakeFiles/shell.dir/dimacs_frontend.cpp.o.d"
+  "CMakeFiles/shell.dir/drat_frontend.cpp.o"
+  "CMakeFiles/shell.dir/drat_frontend.cpp.o.d"
+  "CMakeFiles/shell.dir/gparams_register_modules.cpp.o"
+  "CMakeFiles/shell.dir/gparams_register_modules.cpp.o.d"
+  "CMakeFiles/shell.dir/install_tactic.cpp.o"
+  "CMakeFiles/shell.dir/install_tactic.cpp.o.d"
+  "CMakeFiles/shell.dir/main.cpp.o"
+  "CMakeFiles/shell.dir/main.cpp.o.d"
+  "CMakeFiles/shell.dir/mem_initializer.cpp.o"
+  "CMakeFiles/shell.dir/mem_initializer.cpp.o.d"
+  "CMakeFiles/shell.dir/opt_frontend.cpp.o"
+  "CMakeFiles/shell.dir/opt_frontend.cpp.o.d"
+  "CMakeFiles/shell.dir/smtlib_frontend.cpp.o"
+  "CMakeFiles/shell.dir/smtlib_frontend.cpp.o.d"
+  "CMakeFiles/shell.dir/z3_log_frontend.cpp.o"
+  "CMakeFiles/shell.dir/z3_log_frontend.cpp.o.d"
+  "gparams_register_modules.cpp"
+  "install_tactic.cpp"
+  "mem_initializer.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shell.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,95 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/smt/arith_eq_adapter.cpp" "src/smt/CMakeFiles/smt.dir/arith_eq_adapter.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/arith_eq_adapter.cpp.o.d"
+  "/root/repo/src/smt/arith_eq_solver.cpp" "src/smt/CMakeFiles/smt.dir/arith_eq_solver.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/arith_eq_solver.cpp.o.d"
+  "/root/repo/src/smt/dyn_ack.cpp" "src/smt/CMakeFiles/smt.dir/dyn_ack.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/dyn_ack.cpp.o.d"
+  "/root/repo/src/smt/expr_context_simplifier.cpp" "src/smt/CMakeFiles/smt.dir/expr_context_simplifier.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/expr_context_simplifier.cpp.o.d"
+  "/root/repo/src/smt/fingerprints.cpp" "src/smt/CMakeFiles/smt.dir/fingerprints.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/fingerprints.cpp.o.d"
+  "/root/repo/src/smt/mam.cpp" "src/smt/CMakeFiles/smt.dir/mam.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/mam.cpp.o.d"
+  "/root/repo/src/smt/old_interval.cpp" "src/smt/CMakeFiles/smt.dir/old_interval.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/old_interval.cpp.o.d"
+  "/root/repo/src/smt/qi_queue.cpp" "src/smt/CMakeFiles/smt.dir/qi_queue.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/qi_queue.cpp.o.d"
+  "/root/repo/src/smt/seq_axioms.cpp" "src/smt/CMakeFiles/smt.dir/seq_axioms.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/seq_axioms.cpp.o.d"
+  "/root/repo/src/smt/seq_eq_solver.cpp" "src/smt/CMakeFiles/smt.dir/seq_eq_solver.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/seq_eq_solver.cpp.o.d"
+  "/root/repo/src/smt/seq_ne_solver.cpp" "src/smt/CMakeFiles/smt.dir/seq_ne_solver.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/seq_ne_solver.cpp.o.d"
+  "/root/repo/src/smt/seq_offset_eq.cpp" "src/smt/CMakeFiles/smt.dir/seq_offset_eq.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/seq_offset_eq.cpp.o.d"
+  "/root/repo/src/smt/seq_regex.cpp" "src/smt/CMakeFiles/smt.dir/seq_regex.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/seq_regex.cpp.o.d"
+  "/root/repo/src/smt/smt2_extra_cmds.cpp" "src/smt/CMakeFiles/smt.dir/smt2_extra_cmds.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt2_extra_cmds.cpp.o.d"
+  "/root/repo/src/smt/smt_almost_cg_table.cpp" "src/smt/CMakeFiles/smt.dir/smt_almost_cg_table.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_almost_cg_table.cpp.o.d"
+  "/root/repo/src/smt/smt_arith_value.cpp" "src/smt/CMakeFiles/smt.dir/smt_arith_value.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_arith_value.cpp.o.d"
+  "/root/repo/src/smt/smt_case_split_queue.cpp" "src/smt/CMakeFiles/smt.dir/smt_case_split_queue.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_case_split_queue.cpp.o.d"
+  "/root/repo/src/smt/smt_cg_table.cpp" "src/smt/CMakeFiles/smt.dir/smt_cg_table.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_cg_table.cpp.o.d"
+  "/root/repo/src/smt/smt_checker.cpp" "src/smt/CMakeFiles/smt.dir/smt_checker.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_checker.cpp.o.d"
+  "/root/repo/src/smt/smt_clause.cpp" "src/smt/CMakeFiles/smt.dir/smt_clause.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_clause.cpp.o.d"
+  "/root/repo/src/smt/smt_clause_proof.cpp" "src/smt/CMakeFiles/smt.dir/smt_clause_proof.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_clause_proof.cpp.o.d"
+  "/root/repo/src/smt/smt_conflict_resolution.cpp" "src/smt/CMakeFiles/smt.dir/smt_conflict_resolution.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_conflict_resolution.cpp.o.d"
+  "/root/repo/src/smt/smt_consequences.cpp" "src/smt/CMakeFiles/smt.dir/smt_consequences.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_consequences.cpp.o.d"
+  "/root/repo/src/smt/smt_context.cpp" "src/smt/CMakeFiles/smt.dir/smt_context.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_context.cpp.o.d"
+  "/root/repo/src/smt/smt_context_inv.cpp" "src/smt/CMakeFiles/smt.dir/smt_context_inv.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_context_inv.cpp.o.d"
+  "/root/repo/src/smt/smt_context_pp.cpp" "src/smt/CMakeFiles/smt.dir/smt_context_pp.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_context_pp.cpp.o.d"
+  "/root/repo/src/smt/smt_context_stat.cpp" "src/smt/CMakeFiles/smt.dir/smt_context_stat.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_context_stat.cpp.o.d"
+  "/root/repo/src/smt/smt_enode.cpp" "src/smt/CMakeFiles/smt.dir/smt_enode.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_enode.cpp.o.d"
+  "/root/repo/src/smt/smt_farkas_util.cpp" "src/smt/CMakeFiles/smt.dir/smt_farkas_util.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_farkas_util.cpp.o.d"
+  "/root/repo/src/smt/smt_for_each_relevant_expr.cpp" "src/smt/CMakeFiles/smt.dir/smt_for_each_relevant_expr.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_for_each_relevant_expr.cpp.o.d"
+  "/root/repo/src/smt/smt_implied_equalities.cpp" "src/smt/CMakeFiles/smt.dir/smt_implied_equalities.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_implied_equalities.cpp.o.d"
+  "/root/repo/src/smt/smt_internalizer.cpp" "src/smt/CMakeFiles/smt.dir/smt_internalizer.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_internalizer.cpp.o.d"
+  "/root/repo/src/smt/smt_justification.cpp" "src/smt/CMakeFiles/smt.dir/smt_justification.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_justification.cpp.o.d"
+  "/root/repo/src/smt/smt_kernel.cpp" "src/smt/CMakeFiles/smt.dir/smt_kernel.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_kernel.cpp.o.d"
+  "/root/repo/src/smt/smt_literal.cpp" "src/smt/CMakeFiles/smt.dir/smt_literal.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_literal.cpp.o.d"
+  "/root/repo/src/smt/smt_lookahead.cpp" "src/smt/CMakeFiles/smt.dir/smt_lookahead.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_lookahead.cpp.o.d"
+  "/root/repo/src/smt/smt_model_checker.cpp" "src/smt/CMakeFiles/smt.dir/smt_model_checker.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_model_checker.cpp.o.d"
+  "/root/repo/src/smt/smt_model_finder.cpp" "src/smt/CMakeFiles/smt.dir/smt_model_finder.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_model_finder.cpp.o.d"
+  "/root/repo/src/smt/smt_model_generator.cpp" "src/smt/CMakeFiles/smt.dir/smt_model_generator.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_model_generator.cpp.o.d"
+  "/root/repo/src/smt/smt_parallel.cpp" "src/smt/CMakeFiles/smt.dir/smt_parallel.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_parallel.cpp.o.d"
+  "/root/repo/src/smt/smt_quantifier.cpp" "src/smt/CMakeFiles/smt.dir/smt_quantifier.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_quantifier.cpp.o.d"
+  "/root/repo/src/smt/smt_quick_checker.cpp" "src/smt/CMakeFiles/smt.dir/smt_quick_checker.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_quick_checker.cpp.o.d"
+  "/root/repo/src/smt/smt_relevancy.cpp" "src/smt/CMakeFiles/smt.dir/smt_relevancy.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_relevancy.cpp.o.d"
+  "/root/repo/src/smt/smt_setup.cpp" "src/smt/CMakeFiles/smt.dir/smt_setup.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_setup.cpp.o.d"
+  "/root/repo/src/smt/smt_solver.cpp" "src/smt/CMakeFiles/smt.dir/smt_solver.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_solver.cpp.o.d"
+  "/root/repo/src/smt/smt_statistics.cpp" "src/smt/CMakeFiles/smt.dir/smt_statistics.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_statistics.cpp.o.d"
+  "/root/repo/src/smt/smt_theory.cpp" "src/smt/CMakeFiles/smt.dir/smt_theory.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_theory.cpp.o.d"
+  "/root/repo/src/smt/smt_value_sort.cpp" "src/smt/CMakeFiles/smt.dir/smt_value_sort.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/smt_value_sort.cpp.o.d"
+  "/root/repo/src/smt/theory_arith.cpp" "src/smt/CMakeFiles/smt.dir/theory_arith.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_arith.cpp.o.d"
+  "/root/repo/src/smt/theory_array.cpp" "src/smt/CMakeFiles/smt.dir/theory_array.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_array.cpp.o.d"
+  "/root/repo/src/smt/theory_array_bapa.cpp" "src/smt/CMakeFiles/smt.dir/theory_array_bapa.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_array_bapa.cpp.o.d"
+  "/root/repo/src/smt/theory_array_base.cpp" "src/smt/CMakeFiles/smt.dir/theory_array_base.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_array_base.cpp.o.d"
+  "/root/repo/src/smt/theory_array_full.cpp" "src/smt/CMakeFiles/smt.dir/theory_array_full.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_array_full.cpp.o.d"
+  "/root/repo/src/smt/theory_bv.cpp" "src/smt/CMakeFiles/smt.dir/theory_bv.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_bv.cpp.o.d"
+  "/root/repo/src/smt/theory_char.cpp" "src/smt/CMakeFiles/smt.dir/theory_char.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_char.cpp.o.d"
+  "/root/repo/src/smt/theory_datatype.cpp" "src/smt/CMakeFiles/smt.dir/theory_datatype.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_datatype.cpp.o.d"
+  "/root/repo/src/smt/theory_dense_diff_logic.cpp" "src/smt/CMakeFiles/smt.dir/theory_dense_diff_logic.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_dense_diff_logic.cpp.o.d"
+  "/root/repo/src/smt/theory_diff_logic.cpp" "src/smt/CMakeFiles/smt.dir/theory_diff_logic.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_diff_logic.cpp.o.d"
+  "/root/repo/src/smt/theory_dl.cpp" "src/smt/CMakeFiles/smt.dir/theory_dl.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_dl.cpp.o.d"
+  "/root/repo/src/smt/theory_dummy.cpp" "src/smt/CMakeFiles/smt.dir/theory_dummy.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_dummy.cpp.o.d"
+  "/root/repo/src/smt/theory_fpa.cpp" "src/smt/CMakeFiles/smt.dir/theory_fpa.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_fpa.cpp.o.d"
+  "/root/repo/src/smt/theory_intblast.cpp" "src/smt/CMakeFiles/smt.dir/theory_intblast.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_intblast.cpp.o.d"
+  "/root/repo/src/smt/theory_lra.cpp" "src/smt/CMakeFiles/smt.dir/theory_lra.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_lra.cpp.o.d"
+  "/root/repo/src/smt/theory_opt.cpp" "src/smt/CMakeFiles/smt.dir/theory_opt.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_opt.cpp.o.d"
+  "/root/repo/src/smt/theory_pb.cpp" "src/smt/CMakeFiles/smt.dir/theory_pb.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_pb.cpp.o.d"
+  "/root/repo/src/smt/theory_recfun.cpp" "src/smt/CMakeFiles/smt.dir/theory_recfun.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_recfun.cpp.o.d"
+  "/root/repo/src/smt/theory_seq.cpp" "src/smt/CMakeFiles/smt.dir/theory_seq.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_seq.cpp.o.d"
+  "/root/repo/src/smt/theory_sls.cpp" "src/smt/CMakeFiles/smt.dir/theory_sls.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_sls.cpp.o.d"
+  "/root/repo/src/smt/theory_special_relations.cpp" "src/smt/CMakeFiles/smt.dir/theory_special_relations.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_special_relations.cpp.o.d"
+  "/root/repo/src/smt/theory_str.cpp" "src/smt/CMakeFiles/smt.dir/theory_str.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_str.cpp.o.d"
+  "/root/repo/src/smt/theory_str_mc.cpp" "src/smt/CMakeFiles/smt.dir/theory_str_mc.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_str_mc.cpp.o.d"
+  "/root/repo/src/smt/theory_str_regex.cpp" "src/smt/CMakeFiles/smt.dir/theory_str_regex.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_str_regex.cpp.o.d"
+  "/root/repo/src/smt/theory_user_propagator.cpp" "src/smt/CMakeFiles/smt.dir/theory_user_propagator.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_user_propagator.cpp.o.d"
+  "/root/repo/src/smt/theory_utvpi.cpp" "src/smt/CMakeFiles/smt.dir/theory_utvpi.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_utvpi.cpp.o.d"
+  "/root/repo/src/smt/theory_wmaxsat.cpp" "src/smt/CMakeFiles/smt.dir/theory_wmaxsat.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/theory_wmaxsat.cpp.o.d"
+  "/root/repo/src/smt/uses_theory.cpp" "src/smt/CMakeFiles/smt.dir/uses_theory.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/uses_theory.cpp.o.d"
+  "/root/repo/src/smt/watch_list.cpp" "src/smt/CMakeFiles/smt.dir/watch_list.cpp.o" "gcc" "src/smt/CMakeFiles/smt.dir/watch_list.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,161 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smt.dir/arith_eq_adapter.cpp.o"
+  "CMakeFiles/smt.dir/arith_eq_adapter.cpp.o.d"
+  "CMakeFiles/smt.dir/arith_eq_solver.cpp.o"
+  "CMakeFiles/smt.dir/arith_eq_solver.cpp.o.d"
+  "CMakeFiles/smt.dir/dyn_ack.cpp.o"
+  "CMakeFiles/smt.dir/dyn_ack.cpp.o.d"
+  "CMakeFiles/smt.dir/expr_context_simplifier.cpp.o"
+  "CMakeFiles/smt.dir/expr_context_simplifier.cpp.o.d"
+  "CMakeFiles/smt.dir/fingerprints.cpp.o"
+  "CMakeFiles/smt.dir/fingerprints.cpp.o.d"
+  "CMakeFiles/smt.dir/mam.cpp.o"
+  "CMakeFiles/smt.dir/mam.cpp.o.d"
+  "CMakeFiles/smt.dir/old_interval.cpp.o"
+  "CMakeFiles/smt.dir/old_interval.cpp.o.d"
+  "CMakeFiles/smt.dir/qi_queue.cpp.o"
+  "CMakeFiles/smt.dir/qi_queue.cpp.o.d"
+  "CMakeFiles/smt.dir/seq_axioms.cpp.o"
+  "CMakeFiles/smt.dir/seq_axioms.cpp.o.d"
+  "CMakeFiles/smt.dir/seq_eq_solver.cpp.o"
+  "CMakeFiles/smt.dir/seq_eq_solver.cpp.o.d"
+  "CMakeFiles/smt.dir/seq_ne_solver.cpp.o"
+  "CMakeFiles/smt.dir/seq_ne_solver.cpp.o.d"
+  "CMakeFiles/smt.dir/seq_offset_eq.cpp.o"
+  "CMakeFiles/smt.dir/seq_offset_eq.cpp.o.d"
+  "CMakeFiles/smt.dir/seq_regex.cpp.o"
+  "CMakeFiles/smt.dir/seq_regex.cpp.o.d"
+  "CMakeFiles/smt.dir/smt2_extra_cmds.cpp.o"
+  "CMakeFiles/smt.dir/smt2_extra_cmds.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_almost_cg_table.cpp.o"
+  "CMakeFiles/smt.dir/smt_almost_cg_table.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_arith_value.cpp.o"
+  "CMakeFiles/smt.dir/smt_arith_value.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_case_split_queue.cpp.o"
+  "CMakeFiles/smt.dir/smt_case_split_queue.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_cg_table.cpp.o"
+  "CMakeFiles/smt.dir/smt_cg_table.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_checker.cpp.o"
+  "CMakeFiles/smt.dir/smt_checker.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_clause.cpp.o"
+  "CMakeFiles/smt.dir/smt_clause.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_clause_proof.cpp.o"
+  "CMakeFiles/smt.dir/smt_clause_proof.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_conflict_resolution.cpp.o"
+  "CMakeFiles/smt.dir/smt_conflict_resolution.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_consequences.cpp.o"
+  "CMakeFiles/smt.dir/smt_consequences.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_context.cpp.o"
+  "CMakeFiles/smt.dir/smt_context.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_context_inv.cpp.o"
+  "CMakeFiles/smt.dir/smt_context_inv.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_context_pp.cpp.o"
+  "CMakeFiles/smt.dir/smt_context_pp.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_context_stat.cpp.o"
+  "CMakeFiles/smt.dir/smt_context_stat.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_enode.cpp.o"
+  "CMakeFiles/smt.dir/smt_enode.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_farkas_util.cpp.o"
+  "CMakeFiles/smt.dir/smt_farkas_util.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_for_each_relevant_expr.cpp.o"
+  "CMakeFiles/smt.dir/smt_for_each_relevant_expr.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_implied_equalities.cpp.o"
+  "CMakeFiles/smt.dir/smt_implied_equalities.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_internalizer.cpp.o"
+  "CMakeFiles/smt.dir/smt_internalizer.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_justification.cpp.o"
+  "CMakeFiles/smt.dir/smt_justification.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_kernel.cpp.o"
+  "CMakeFiles/smt.dir/smt_kernel.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_literal.cpp.o"
+  "CMakeFiles/smt.dir/smt_literal.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_lookahead.cpp.o"
+  "CMakeFiles/smt.dir/smt_lookahead.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_model_checker.cpp.o"
+  "CMakeFiles/smt.dir/smt_model_checker.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_model_finder.cpp.o"
+  "CMakeFiles/smt.dir/smt_model_finder.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_model_generator.cpp.o"
+  "CMakeFiles/smt.dir/smt_model_generator.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_parallel.cpp.o"
+  "CMakeFiles/smt.dir/smt_parallel.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_quantifier.cpp.o"
+  "CMakeFiles/smt.dir/smt_quantifier.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_quick_checker.cpp.o"
+  "CMakeFiles/smt.dir/smt_quick_checker.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_relevancy.cpp.o"
+  "CMakeFiles/smt.dir/smt_relevancy.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_setup.cpp.o"
+  "CMakeFiles/smt.dir/smt_setup.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_solver.cpp.o"
+  "CMakeFiles/smt.dir/smt_solver.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_statistics.cpp.o"
+  "CMakeFiles/smt.dir/smt_statistics.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_theory.cpp.o"
+  "CMakeFiles/smt.dir/smt_theory.cpp.o.d"
+  "CMakeFiles/smt.dir/smt_value_sort.cpp.o"
+  "CMakeFiles/smt.dir/smt_value_sort.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_arith.cpp.o"
+  "CMakeFiles/smt.dir/theory_arith.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_array.cpp.o"
+  "CMakeFiles/smt.dir/theory_array.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_array_bapa.cpp.o"
+  "CMakeFiles/smt.dir/theory_array_bapa.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_array_base.cpp.o"
+  "CMakeFiles/smt.dir/theory_array_base.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_array_full.cpp.o"
+  "CMakeFiles/smt.dir/theory_array_full.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_bv.cpp.o"
+  "CMakeFiles/smt.dir/theory_bv.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_char.cpp.o"
+  "CMakeFiles/smt.dir/theory_char.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_datatype.cpp.o"
+  "CMakeFiles/smt.dir/theory_datatype.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_dense_diff_logic.cpp.o"
+  "CMakeFiles/smt.dir/theory_dense_diff_logic.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_diff_logic.cpp.o"
+  "CMakeFiles/smt.dir/theory_diff_logic.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_dl.cpp.o"
+  "CMakeFiles/smt.dir/theory_dl.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_dummy.cpp.o"
+  "CMakeFiles/smt.dir/theory_dummy.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_fpa.cpp.o"
+  "CMakeFiles/smt.dir/theory_fpa.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_intblast.cpp.o"
+  "CMakeFiles/smt.dir/theory_intblast.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_lra.cpp.o"
+  "CMakeFiles/smt.dir/theory_lra.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_opt.cpp.o"
+  "CMakeFiles/smt.dir/theory_opt.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_pb.cpp.o"
+  "CMakeFiles/smt.dir/theory_pb.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_recfun.cpp.o"
+  "CMakeFiles/smt.dir/theory_recfun.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_seq.cpp.o"
+  "CMakeFiles/smt.dir/theory_seq.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_sls.cpp.o"
+  "CMakeFiles/smt.dir/theory_sls.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_special_relations.cpp.o"
+  "CMakeFiles/smt.dir/theory_special_relations.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_str.cpp.o"
+  "CMakeFiles/smt.dir/theory_str.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_str_mc.cpp.o"
+  "CMakeFiles/smt.dir/theory_str_mc.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_str_regex.cpp.o"
+  "CMakeFiles/smt.dir/theory_str_regex.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_user_propagator.cpp.o"
+  "CMakeFiles/smt.dir/theory_user_propagator.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_utvpi.cpp.o"
+  "CMakeFiles/smt.dir/theory_utvpi.cpp.o.d"
+  "CMakeFiles/smt.dir/theory_wmaxsat.cpp.o"
+  "CMakeFiles/smt.dir/theory_wmaxsat.cpp.o.d"
+  "CMakeFiles/smt.dir/uses_theory.cpp.o"
+  "CMakeFiles/smt.dir/uses_theory.cpp.o.d"
+  "CMakeFiles/smt.dir/watch_list.cpp.o"
+  "CMakeFiles/smt.dir/watch_list.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
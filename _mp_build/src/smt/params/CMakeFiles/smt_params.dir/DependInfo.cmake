@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/smt/params/dyn_ack_params.cpp" "src/smt/params/CMakeFiles/smt_params.dir/dyn_ack_params.cpp.o" "gcc" "src/smt/params/CMakeFiles/smt_params.dir/dyn_ack_params.cpp.o.d"
+  "/root/repo/src/smt/params/preprocessor_params.cpp" "src/smt/params/CMakeFiles/smt_params.dir/preprocessor_params.cpp.o" "gcc" "src/smt/params/CMakeFiles/smt_params.dir/preprocessor_params.cpp.o.d"
+  "/root/repo/src/smt/params/qi_params.cpp" "src/smt/params/CMakeFiles/smt_params.dir/qi_params.cpp.o" "gcc" "src/smt/params/CMakeFiles/smt_params.dir/qi_params.cpp.o.d"
+  "/root/repo/src/smt/params/smt_params.cpp" "src/smt/params/CMakeFiles/smt_params.dir/smt_params.cpp.o" "gcc" "src/smt/params/CMakeFiles/smt_params.dir/smt_params.cpp.o.d"
+  "/root/repo/src/smt/params/theory_arith_params.cpp" "src/smt/params/CMakeFiles/smt_params.dir/theory_arith_params.cpp.o" "gcc" "src/smt/params/CMakeFiles/smt_params.dir/theory_arith_params.cpp.o.d"
+  "/root/repo/src/smt/params/theory_array_params.cpp" "src/smt/params/CMakeFiles/smt_params.dir/theory_array_params.cpp.o" "gcc" "src/smt/params/CMakeFiles/smt_params.dir/theory_array_params.cpp.o.d"
+  "/root/repo/src/smt/params/theory_bv_params.cpp" "src/smt/params/CMakeFiles/smt_params.dir/theory_bv_params.cpp.o" "gcc" "src/smt/params/CMakeFiles/smt_params.dir/theory_bv_params.cpp.o.d"
+  "/root/repo/src/smt/params/theory_pb_params.cpp" "src/smt/params/CMakeFiles/smt_params.dir/theory_pb_params.cpp.o" "gcc" "src/smt/params/CMakeFiles/smt_params.dir/theory_pb_params.cpp.o.d"
+  "/root/repo/src/smt/params/theory_seq_params.cpp" "src/smt/params/CMakeFiles/smt_params.dir/theory_seq_params.cpp.o" "gcc" "src/smt/params/CMakeFiles/smt_params.dir/theory_seq_params.cpp.o.d"
+  "/root/repo/src/smt/params/theory_str_params.cpp" "src/smt/params/CMakeFiles/smt_params.dir/theory_str_params.cpp.o" "gcc" "src/smt/params/CMakeFiles/smt_params.dir/theory_str_params.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,28 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smt_params.dir/dyn_ack_params.cpp.o"
+  "CMakeFiles/smt_params.dir/dyn_ack_params.cpp.o.d"
+  "CMakeFiles/smt_params.dir/preprocessor_params.cpp.o"
+  "CMakeFiles/smt_params.dir/preprocessor_params.cpp.o.d"
+  "CMakeFiles/smt_params.dir/qi_params.cpp.o"
+  "CMakeFiles/smt_params.dir/qi_params.cpp.o.d"
+  "CMakeFiles/smt_params.dir/smt_params.cpp.o"
+  "CMakeFiles/smt_params.dir/smt_params.cpp.o.d"
+  "CMakeFiles/smt_params.dir/theory_arith_params.cpp.o"
+  "CMakeFiles/smt_params.dir/theory_arith_params.cpp.o.d"
+  "CMakeFiles/smt_params.dir/theory_array_params.cpp.o"
+  "CMakeFiles/smt_params.dir/theory_array_params.cpp.o.d"
+  "CMakeFiles/smt_params.dir/theory_bv_params.cpp.o"
+  "CMakeFiles/smt_params.dir/theory_bv_params.cpp.o.d"
+  "CMakeFiles/smt_params.dir/theory_pb_params.cpp.o"
+  "CMakeFiles/smt_params.dir/theory_pb_params.cpp.o.d"
+  "CMakeFiles/smt_params.dir/theory_seq_params.cpp.o"
+  "CMakeFiles/smt_params.dir/theory_seq_params.cpp.o.d"
+  "CMakeFiles/smt_params.dir/theory_str_params.cpp.o"
+  "CMakeFiles/smt_params.dir/theory_str_params.cpp.o.d"
+  "smt_params_helper.hpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smt_params.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
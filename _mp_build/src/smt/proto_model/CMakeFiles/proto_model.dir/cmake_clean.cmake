@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/proto_model.dir/proto_model.cpp.o"
+  "CMakeFiles/proto_model.dir/proto_model.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/proto_model.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/smt/tactic/ctx_solver_simplify_tactic.cpp" "src/smt/tactic/CMakeFiles/smt_tactic.dir/ctx_solver_simplify_tactic.cpp.o" "gcc" "src/smt/tactic/CMakeFiles/smt_tactic.dir/ctx_solver_simplify_tactic.cpp.o.d"
+  "/root/repo/src/smt/tactic/smt_tactic_core.cpp" "src/smt/tactic/CMakeFiles/smt_tactic.dir/smt_tactic_core.cpp.o" "gcc" "src/smt/tactic/CMakeFiles/smt_tactic.dir/smt_tactic_core.cpp.o.d"
+  "/root/repo/src/smt/tactic/unit_subsumption_tactic.cpp" "src/smt/tactic/CMakeFiles/smt_tactic.dir/unit_subsumption_tactic.cpp.o" "gcc" "src/smt/tactic/CMakeFiles/smt_tactic.dir/unit_subsumption_tactic.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smt_tactic.dir/ctx_solver_simplify_tactic.cpp.o"
+  "CMakeFiles/smt_tactic.dir/ctx_solver_simplify_tactic.cpp.o.d"
+  "CMakeFiles/smt_tactic.dir/smt_tactic_core.cpp.o"
+  "CMakeFiles/smt_tactic.dir/smt_tactic_core.cpp.o.d"
+  "CMakeFiles/smt_tactic.dir/unit_subsumption_tactic.cpp.o"
+  "CMakeFiles/smt_tactic.dir/unit_subsumption_tactic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smt_tactic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
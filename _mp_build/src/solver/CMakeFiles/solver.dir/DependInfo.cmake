@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/solver/check_logic.cpp" "src/solver/CMakeFiles/solver.dir/check_logic.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/check_logic.cpp.o.d"
+  "/root/repo/src/solver/check_sat_result.cpp" "src/solver/CMakeFiles/solver.dir/check_sat_result.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/check_sat_result.cpp.o.d"
+  "/root/repo/src/solver/combined_solver.cpp" "src/solver/CMakeFiles/solver.dir/combined_solver.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/combined_solver.cpp.o.d"
+  "/root/repo/src/solver/mus.cpp" "src/solver/CMakeFiles/solver.dir/mus.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/mus.cpp.o.d"
+  "/root/repo/src/solver/parallel_pool.cpp" "src/solver/CMakeFiles/solver.dir/parallel_pool.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/parallel_pool.cpp.o.d"
+  "/root/repo/src/solver/parallel_tactical.cpp" "src/solver/CMakeFiles/solver.dir/parallel_tactical.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/parallel_tactical.cpp.o.d"
+  "/root/repo/src/solver/simplifier_solver.cpp" "src/solver/CMakeFiles/solver.dir/simplifier_solver.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/simplifier_solver.cpp.o.d"
+  "/root/repo/src/solver/slice_solver.cpp" "src/solver/CMakeFiles/solver.dir/slice_solver.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/slice_solver.cpp.o.d"
+  "/root/repo/src/solver/smt_logics.cpp" "src/solver/CMakeFiles/solver.dir/smt_logics.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/smt_logics.cpp.o.d"
+  "/root/repo/src/solver/solver.cpp" "src/solver/CMakeFiles/solver.dir/solver.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/solver.cpp.o.d"
+  "/root/repo/src/solver/solver2tactic.cpp" "src/solver/CMakeFiles/solver.dir/solver2tactic.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/solver2tactic.cpp.o.d"
+  "/root/repo/src/solver/solver_na2as.cpp" "src/solver/CMakeFiles/solver.dir/solver_na2as.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/solver_na2as.cpp.o.d"
+  "/root/repo/src/solver/solver_pool.cpp" "src/solver/CMakeFiles/solver.dir/solver_pool.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/solver_pool.cpp.o.d"
+  "/root/repo/src/solver/solver_preprocess.cpp" "src/solver/CMakeFiles/solver.dir/solver_preprocess.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/solver_preprocess.cpp.o.d"
+  "/root/repo/src/solver/tactic2solver.cpp" "src/solver/CMakeFiles/solver.dir/tactic2solver.cpp.o" "gcc" "src/solver/CMakeFiles/solver.dir/tactic2solver.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
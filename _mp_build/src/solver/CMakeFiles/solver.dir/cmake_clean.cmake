@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/solver.dir/check_logic.cpp.o"
+  "CMakeFiles/solver.dir/check_logic.cpp.o.d"
+  "CMakeFiles/solver.dir/check_sat_result.cpp.o"
+  "CMakeFiles/solver.dir/check_sat_result.cpp.o.d"
+  "CMakeFiles/solver.dir/combined_solver.cpp.o"
+  "CMakeFiles/solver.dir/combined_solver.cpp.o.d"
+  "CMakeFiles/solver.dir/mus.cpp.o"
+  "CMakeFiles/solver.dir/mus.cpp.o.d"
+  "CMakeFiles/solver.dir/parallel_pool.cpp.o"
+  "CMakeFiles/solver.dir/parallel_pool.cpp.o.d"
+  "CMakeFiles/solver.dir/parallel_tactical.cpp.o"
+  "CMakeFiles/solver.dir/parallel_tactical.cpp.o.d"
+  "CMakeFiles/solver.dir/simplifier_solver.cpp.o"
+  "CMakeFiles/solver.dir/simplifier_solver.cpp.o.d"
+  "CMakeFiles/solver.dir/slice_solver.cpp.o"
+  "CMakeFiles/solver.dir/slice_solver.cpp.o.d"
+  "CMakeFiles/solver.dir/smt_logics.cpp.o"
+  "CMakeFiles/solver.dir/smt_logics.cpp.o.d"
+  "CMakeFiles/solver.dir/solver.cpp.o"
+  "CMakeFiles/solver.dir/solver.cpp.o.d"
+  "CMakeFiles/solver.dir/solver2tactic.cpp.o"
+  "CMakeFiles/solver.dir/solver2tactic.cpp.o.d"
+  "CMakeFiles/solver.dir/solver_na2as.cpp.o"
+  "CMakeFiles/solver.dir/solver_na2as.cpp.o.d"
+  "CMakeFiles/solver.dir/solver_pool.cpp.o"
+  "CMakeFiles/solver.dir/solver_pool.cpp.o.d"
+  "CMakeFiles/solver.dir/solver_preprocess.cpp.o"
+  "CMakeFiles/solver.dir/solver_preprocess.cpp.o.d"
+  "CMakeFiles/solver.dir/tactic2solver.cpp.o"
+  "CMakeFiles/solver.dir/tactic2solver.cpp.o.d"
+  "combined_solver_params.hpp"
+  "parallel_params.hpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/solver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
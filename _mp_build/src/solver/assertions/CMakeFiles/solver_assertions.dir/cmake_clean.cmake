@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/solver_assertions.dir/asserted_formulas.cpp.o"
+  "CMakeFiles/solver_assertions.dir/asserted_formulas.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/solver_assertions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tactic/dependency_converter.cpp" "src/tactic/CMakeFiles/tactic.dir/dependency_converter.cpp.o" "gcc" "src/tactic/CMakeFiles/tactic.dir/dependency_converter.cpp.o.d"
+  "/root/repo/src/tactic/goal.cpp" "src/tactic/CMakeFiles/tactic.dir/goal.cpp.o" "gcc" "src/tactic/CMakeFiles/tactic.dir/goal.cpp.o.d"
+  "/root/repo/src/tactic/goal_num_occurs.cpp" "src/tactic/CMakeFiles/tactic.dir/goal_num_occurs.cpp.o" "gcc" "src/tactic/CMakeFiles/tactic.dir/goal_num_occurs.cpp.o.d"
+  "/root/repo/src/tactic/goal_shared_occs.cpp" "src/tactic/CMakeFiles/tactic.dir/goal_shared_occs.cpp.o" "gcc" "src/tactic/CMakeFiles/tactic.dir/goal_shared_occs.cpp.o.d"
+  "/root/repo/src/tactic/goal_util.cpp" "src/tactic/CMakeFiles/tactic.dir/goal_util.cpp.o" "gcc" "src/tactic/CMakeFiles/tactic.dir/goal_util.cpp.o.d"
+  "/root/repo/src/tactic/probe.cpp" "src/tactic/CMakeFiles/tactic.dir/probe.cpp.o" "gcc" "src/tactic/CMakeFiles/tactic.dir/probe.cpp.o.d"
+  "/root/repo/src/tactic/tactic.cpp" "src/tactic/CMakeFiles/tactic.dir/tactic.cpp.o" "gcc" "src/tactic/CMakeFiles/tactic.dir/tactic.cpp.o.d"
+  "/root/repo/src/tactic/tactical.cpp" "src/tactic/CMakeFiles/tactic.dir/tactical.cpp.o" "gcc" "src/tactic/CMakeFiles/tactic.dir/tactical.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tactic.dir/dependency_converter.cpp.o"
+  "CMakeFiles/tactic.dir/dependency_converter.cpp.o.d"
+  "CMakeFiles/tactic.dir/goal.cpp.o"
+  "CMakeFiles/tactic.dir/goal.cpp.o.d"
+  "CMakeFiles/tactic.dir/goal_num_occurs.cpp.o"
+  "CMakeFiles/tactic.dir/goal_num_occurs.cpp.o.d"
+  "CMakeFiles/tactic.dir/goal_shared_occs.cpp.o"
+  "CMakeFiles/tactic.dir/goal_shared_occs.cpp.o.d"
+  "CMakeFiles/tactic.dir/goal_util.cpp.o"
+  "CMakeFiles/tactic.dir/goal_util.cpp.o.d"
+  "CMakeFiles/tactic.dir/probe.cpp.o"
+  "CMakeFiles/tactic.dir/probe.cpp.o.d"
+  "CMakeFiles/tactic.dir/tactic.cpp.o"
+  "CMakeFiles/tactic.dir/tactic.cpp.o.d"
+  "CMakeFiles/tactic.dir/tactical.cpp.o"
+  "CMakeFiles/tactic.dir/tactical.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tactic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
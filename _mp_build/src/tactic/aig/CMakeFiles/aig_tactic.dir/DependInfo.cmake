@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tactic/aig/aig.cpp" "src/tactic/aig/CMakeFiles/aig_tactic.dir/aig.cpp.o" "gcc" "src/tactic/aig/CMakeFiles/aig_tactic.dir/aig.cpp.o.d"
+  "/root/repo/src/tactic/aig/aig_synth.cpp" "src/tactic/aig/CMakeFiles/aig_tactic.dir/aig_synth.cpp.o" "gcc" "src/tactic/aig/CMakeFiles/aig_tactic.dir/aig_synth.cpp.o.d"
+  "/root/repo/src/tactic/aig/aig_tactic.cpp" "src/tactic/aig/CMakeFiles/aig_tactic.dir/aig_tactic.cpp.o" "gcc" "src/tactic/aig/CMakeFiles/aig_tactic.dir/aig_tactic.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/aig_tactic.dir/aig.cpp.o"
+  "CMakeFiles/aig_tactic.dir/aig.cpp.o.d"
+  "CMakeFiles/aig_tactic.dir/aig_synth.cpp.o"
+  "CMakeFiles/aig_tactic.dir/aig_synth.cpp.o.d"
+  "CMakeFiles/aig_tactic.dir/aig_tactic.cpp.o"
+  "CMakeFiles/aig_tactic.dir/aig_tactic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/aig_tactic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tactic/arith/add_bounds_tactic.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/add_bounds_tactic.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/add_bounds_tactic.cpp.o.d"
+  "/root/repo/src/tactic/arith/arith_bounds_tactic.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/arith_bounds_tactic.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/arith_bounds_tactic.cpp.o.d"
+  "/root/repo/src/tactic/arith/bv2int_rewriter.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/bv2int_rewriter.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/bv2int_rewriter.cpp.o.d"
+  "/root/repo/src/tactic/arith/bv2real_rewriter.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/bv2real_rewriter.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/bv2real_rewriter.cpp.o.d"
+  "/root/repo/src/tactic/arith/degree_shift_tactic.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/degree_shift_tactic.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/degree_shift_tactic.cpp.o.d"
+  "/root/repo/src/tactic/arith/diff_neq_tactic.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/diff_neq_tactic.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/diff_neq_tactic.cpp.o.d"
+  "/root/repo/src/tactic/arith/eq2bv_tactic.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/eq2bv_tactic.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/eq2bv_tactic.cpp.o.d"
+  "/root/repo/src/tactic/arith/factor_tactic.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/factor_tactic.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/factor_tactic.cpp.o.d"
+  "/root/repo/src/tactic/arith/fix_dl_var_tactic.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/fix_dl_var_tactic.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/fix_dl_var_tactic.cpp.o.d"
+  "/root/repo/src/tactic/arith/fm_tactic.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/fm_tactic.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/fm_tactic.cpp.o.d"
+  "/root/repo/src/tactic/arith/lia2card_tactic.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/lia2card_tactic.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/lia2card_tactic.cpp.o.d"
+  "/root/repo/src/tactic/arith/lia2pb_tactic.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/lia2pb_tactic.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/lia2pb_tactic.cpp.o.d"
+  "/root/repo/src/tactic/arith/nla2bv_tactic.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/nla2bv_tactic.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/nla2bv_tactic.cpp.o.d"
+  "/root/repo/src/tactic/arith/normalize_bounds_tactic.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/normalize_bounds_tactic.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/normalize_bounds_tactic.cpp.o.d"
+  "/root/repo/src/tactic/arith/pb2bv_model_converter.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/pb2bv_model_converter.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/pb2bv_model_converter.cpp.o.d"
+  "/root/repo/src/tactic/arith/pb2bv_tactic.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/pb2bv_tactic.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/pb2bv_tactic.cpp.o.d"
+  "/root/repo/src/tactic/arith/probe_arith.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/probe_arith.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/probe_arith.cpp.o.d"
+  "/root/repo/src/tactic/arith/purify_arith_tactic.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/purify_arith_tactic.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/purify_arith_tactic.cpp.o.d"
+  "/root/repo/src/tactic/arith/recover_01_tactic.cpp" "src/tactic/arith/CMakeFiles/arith_tactics.dir/recover_01_tactic.cpp.o" "gcc" "src/tactic/arith/CMakeFiles/arith_tactics.dir/recover_01_tactic.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arith_tactics.dir/add_bounds_tactic.cpp.o"
+  "CMakeFiles/arith_tactics.dir/add_bounds_tactic.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/arith_bounds_tactic.cpp.o"
+  "CMakeFiles/arith_tactics.dir/arith_bounds_tactic.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/bv2int_rewriter.cpp.o"
+  "CMakeFiles/arith_tactics.dir/bv2int_rewriter.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/bv2real_rewriter.cpp.o"
+  "CMakeFiles/arith_tactics.dir/bv2real_rewriter.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/degree_shift_tactic.cpp.o"
+  "CMakeFiles/arith_tactics.dir/degree_shift_tactic.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/diff_neq_tactic.cpp.o"
+  "CMakeFiles/arith_tactics.dir/diff_neq_tactic.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/eq2bv_tactic.cpp.o"
+  "CMakeFiles/arith_tactics.dir/eq2bv_tactic.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/factor_tactic.cpp.o"
+  "CMakeFiles/arith_tactics.dir/factor_tactic.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/fix_dl_var_tactic.cpp.o"
+  "CMakeFiles/arith_tactics.dir/fix_dl_var_tactic.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/fm_tactic.cpp.o"
+  "CMakeFiles/arith_tactics.dir/fm_tactic.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/lia2card_tactic.cpp.o"
+  "CMakeFiles/arith_tactics.dir/lia2card_tactic.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/lia2pb_tactic.cpp.o"
+  "CMakeFiles/arith_tactics.dir/lia2pb_tactic.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/nla2bv_tactic.cpp.o"
+  "CMakeFiles/arith_tactics.dir/nla2bv_tactic.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/normalize_bounds_tactic.cpp.o"
+  "CMakeFiles/arith_tactics.dir/normalize_bounds_tactic.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/pb2bv_model_converter.cpp.o"
+  "CMakeFiles/arith_tactics.dir/pb2bv_model_converter.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/pb2bv_tactic.cpp.o"
+  "CMakeFiles/arith_tactics.dir/pb2bv_tactic.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/probe_arith.cpp.o"
+  "CMakeFiles/arith_tactics.dir/probe_arith.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/purify_arith_tactic.cpp.o"
+  "CMakeFiles/arith_tactics.dir/purify_arith_tactic.cpp.o.d"
+  "CMakeFiles/arith_tactics.dir/recover_01_tactic.cpp.o"
+  "CMakeFiles/arith_tactics.dir/recover_01_tactic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arith_tactics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
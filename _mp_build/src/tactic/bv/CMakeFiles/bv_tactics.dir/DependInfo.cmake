@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tactic/bv/bit_blaster_model_converter.cpp" "src/tactic/bv/CMakeFiles/bv_tactics.dir/bit_blaster_model_converter.cpp.o" "gcc" "src/tactic/bv/CMakeFiles/bv_tactics.dir/bit_blaster_model_converter.cpp.o.d"
+  "/root/repo/src/tactic/bv/bit_blaster_tactic.cpp" "src/tactic/bv/CMakeFiles/bv_tactics.dir/bit_blaster_tactic.cpp.o" "gcc" "src/tactic/bv/CMakeFiles/bv_tactics.dir/bit_blaster_tactic.cpp.o.d"
+  "/root/repo/src/tactic/bv/bv1_blaster_tactic.cpp" "src/tactic/bv/CMakeFiles/bv_tactics.dir/bv1_blaster_tactic.cpp.o" "gcc" "src/tactic/bv/CMakeFiles/bv_tactics.dir/bv1_blaster_tactic.cpp.o.d"
+  "/root/repo/src/tactic/bv/bv_bound_chk_tactic.cpp" "src/tactic/bv/CMakeFiles/bv_tactics.dir/bv_bound_chk_tactic.cpp.o" "gcc" "src/tactic/bv/CMakeFiles/bv_tactics.dir/bv_bound_chk_tactic.cpp.o.d"
+  "/root/repo/src/tactic/bv/bv_bounds_tactic.cpp" "src/tactic/bv/CMakeFiles/bv_tactics.dir/bv_bounds_tactic.cpp.o" "gcc" "src/tactic/bv/CMakeFiles/bv_tactics.dir/bv_bounds_tactic.cpp.o.d"
+  "/root/repo/src/tactic/bv/bv_size_reduction_tactic.cpp" "src/tactic/bv/CMakeFiles/bv_tactics.dir/bv_size_reduction_tactic.cpp.o" "gcc" "src/tactic/bv/CMakeFiles/bv_tactics.dir/bv_size_reduction_tactic.cpp.o.d"
+  "/root/repo/src/tactic/bv/bvarray2uf_rewriter.cpp" "src/tactic/bv/CMakeFiles/bv_tactics.dir/bvarray2uf_rewriter.cpp.o" "gcc" "src/tactic/bv/CMakeFiles/bv_tactics.dir/bvarray2uf_rewriter.cpp.o.d"
+  "/root/repo/src/tactic/bv/bvarray2uf_tactic.cpp" "src/tactic/bv/CMakeFiles/bv_tactics.dir/bvarray2uf_tactic.cpp.o" "gcc" "src/tactic/bv/CMakeFiles/bv_tactics.dir/bvarray2uf_tactic.cpp.o.d"
+  "/root/repo/src/tactic/bv/dt2bv_tactic.cpp" "src/tactic/bv/CMakeFiles/bv_tactics.dir/dt2bv_tactic.cpp.o" "gcc" "src/tactic/bv/CMakeFiles/bv_tactics.dir/dt2bv_tactic.cpp.o.d"
+  "/root/repo/src/tactic/bv/elim_small_bv_tactic.cpp" "src/tactic/bv/CMakeFiles/bv_tactics.dir/elim_small_bv_tactic.cpp.o" "gcc" "src/tactic/bv/CMakeFiles/bv_tactics.dir/elim_small_bv_tactic.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bv_tactics.dir/bit_blaster_model_converter.cpp.o"
+  "CMakeFiles/bv_tactics.dir/bit_blaster_model_converter.cpp.o.d"
+  "CMakeFiles/bv_tactics.dir/bit_blaster_tactic.cpp.o"
+  "CMakeFiles/bv_tactics.dir/bit_blaster_tactic.cpp.o.d"
+  "CMakeFiles/bv_tactics.dir/bv1_blaster_tactic.cpp.o"
+  "CMakeFiles/bv_tactics.dir/bv1_blaster_tactic.cpp.o.d"
+  "CMakeFiles/bv_tactics.dir/bv_bound_chk_tactic.cpp.o"
+  "CMakeFiles/bv_tactics.dir/bv_bound_chk_tactic.cpp.o.d"
+  "CMakeFiles/bv_tactics.dir/bv_bounds_tactic.cpp.o"
+  "CMakeFiles/bv_tactics.dir/bv_bounds_tactic.cpp.o.d"
+  "CMakeFiles/bv_tactics.dir/bv_size_reduction_tactic.cpp.o"
+  "CMakeFiles/bv_tactics.dir/bv_size_reduction_tactic.cpp.o.d"
+  "CMakeFiles/bv_tactics.dir/bvarray2uf_rewriter.cpp.o"
+  "CMakeFiles/bv_tactics.dir/bvarray2uf_rewriter.cpp.o.d"
+  "CMakeFiles/bv_tactics.dir/bvarray2uf_tactic.cpp.o"
+  "CMakeFiles/bv_tactics.dir/bvarray2uf_tactic.cpp.o.d"
+  "CMakeFiles/bv_tactics.dir/dt2bv_tactic.cpp.o"
+  "CMakeFiles/bv_tactics.dir/dt2bv_tactic.cpp.o.d"
+  "CMakeFiles/bv_tactics.dir/elim_small_bv_tactic.cpp.o"
+  "CMakeFiles/bv_tactics.dir/elim_small_bv_tactic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bv_tactics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
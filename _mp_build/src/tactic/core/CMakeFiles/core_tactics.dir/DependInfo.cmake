@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tactic/core/blast_term_ite_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/blast_term_ite_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/blast_term_ite_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/cofactor_elim_term_ite.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/cofactor_elim_term_ite.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/cofactor_elim_term_ite.cpp.o.d"
+  "/root/repo/src/tactic/core/cofactor_term_ite_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/cofactor_term_ite_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/cofactor_term_ite_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/collect_occs.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/collect_occs.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/collect_occs.cpp.o.d"
+  "/root/repo/src/tactic/core/collect_statistics_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/collect_statistics_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/collect_statistics_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/ctx_simplify_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/ctx_simplify_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/ctx_simplify_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/der_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/der_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/der_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/elim_term_ite_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/elim_term_ite_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/elim_term_ite_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/elim_uncnstr_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/elim_uncnstr_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/elim_uncnstr_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/euf_completion_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/euf_completion_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/euf_completion_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/injectivity_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/injectivity_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/injectivity_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/nnf_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/nnf_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/nnf_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/occf_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/occf_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/occf_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/pb_preprocess_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/pb_preprocess_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/pb_preprocess_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/propagate_values_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/propagate_values_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/propagate_values_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/reduce_args_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/reduce_args_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/reduce_args_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/simplify_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/simplify_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/simplify_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/special_relations_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/special_relations_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/special_relations_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/split_clause_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/split_clause_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/split_clause_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/symmetry_reduce_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/symmetry_reduce_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/symmetry_reduce_tactic.cpp.o.d"
+  "/root/repo/src/tactic/core/tseitin_cnf_tactic.cpp" "src/tactic/core/CMakeFiles/core_tactics.dir/tseitin_cnf_tactic.cpp.o" "gcc" "src/tactic/core/CMakeFiles/core_tactics.dir/tseitin_cnf_tactic.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,49 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/core_tactics.dir/blast_term_ite_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/blast_term_ite_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/cofactor_elim_term_ite.cpp.o"
+  "CMakeFiles/core_tactics.dir/cofactor_elim_term_ite.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/cofactor_term_ite_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/cofactor_term_ite_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/collect_occs.cpp.o"
+  "CMakeFiles/core_tactics.dir/collect_occs.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/collect_statistics_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/collect_statistics_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/ctx_simplify_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/ctx_simplify_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/der_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/der_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/elim_term_ite_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/elim_term_ite_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/elim_uncnstr_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/elim_uncnstr_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/euf_completion_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/euf_completion_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/injectivity_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/injectivity_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/nnf_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/nnf_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/occf_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/occf_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/pb_preprocess_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/pb_preprocess_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/propagate_values_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/propagate_values_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/reduce_args_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/reduce_args_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/simplify_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/simplify_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/special_relations_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/special_relations_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/split_clause_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/split_clause_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/symmetry_reduce_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/symmetry_reduce_tactic.cpp.o.d"
+  "CMakeFiles/core_tactics.dir/tseitin_cnf_tactic.cpp.o"
+  "CMakeFiles/core_tactics.dir/tseitin_cnf_tactic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/core_tactics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tactic/fd_solver/bounded_int2bv_solver.cpp" "src/tactic/fd_solver/CMakeFiles/fd_solver.dir/bounded_int2bv_solver.cpp.o" "gcc" "src/tactic/fd_solver/CMakeFiles/fd_solver.dir/bounded_int2bv_solver.cpp.o.d"
+  "/root/repo/src/tactic/fd_solver/enum2bv_solver.cpp" "src/tactic/fd_solver/CMakeFiles/fd_solver.dir/enum2bv_solver.cpp.o" "gcc" "src/tactic/fd_solver/CMakeFiles/fd_solver.dir/enum2bv_solver.cpp.o.d"
+  "/root/repo/src/tactic/fd_solver/fd_solver.cpp" "src/tactic/fd_solver/CMakeFiles/fd_solver.dir/fd_solver.cpp.o" "gcc" "src/tactic/fd_solver/CMakeFiles/fd_solver.dir/fd_solver.cpp.o.d"
+  "/root/repo/src/tactic/fd_solver/pb2bv_solver.cpp" "src/tactic/fd_solver/CMakeFiles/fd_solver.dir/pb2bv_solver.cpp.o" "gcc" "src/tactic/fd_solver/CMakeFiles/fd_solver.dir/pb2bv_solver.cpp.o.d"
+  "/root/repo/src/tactic/fd_solver/smtfd_solver.cpp" "src/tactic/fd_solver/CMakeFiles/fd_solver.dir/smtfd_solver.cpp.o" "gcc" "src/tactic/fd_solver/CMakeFiles/fd_solver.dir/smtfd_solver.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fd_solver.dir/bounded_int2bv_solver.cpp.o"
+  "CMakeFiles/fd_solver.dir/bounded_int2bv_solver.cpp.o.d"
+  "CMakeFiles/fd_solver.dir/enum2bv_solver.cpp.o"
+  "CMakeFiles/fd_solver.dir/enum2bv_solver.cpp.o.d"
+  "CMakeFiles/fd_solver.dir/fd_solver.cpp.o"
+  "CMakeFiles/fd_solver.dir/fd_solver.cpp.o.d"
+  "CMakeFiles/fd_solver.dir/pb2bv_solver.cpp.o"
+  "CMakeFiles/fd_solver.dir/pb2bv_solver.cpp.o.d"
+  "CMakeFiles/fd_solver.dir/smtfd_solver.cpp.o"
+  "CMakeFiles/fd_solver.dir/smtfd_solver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fd_solver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tactic/fpa/fpa2bv_model_converter.cpp" "src/tactic/fpa/CMakeFiles/fpa_tactics.dir/fpa2bv_model_converter.cpp.o" "gcc" "src/tactic/fpa/CMakeFiles/fpa_tactics.dir/fpa2bv_model_converter.cpp.o.d"
+  "/root/repo/src/tactic/fpa/fpa2bv_tactic.cpp" "src/tactic/fpa/CMakeFiles/fpa_tactics.dir/fpa2bv_tactic.cpp.o" "gcc" "src/tactic/fpa/CMakeFiles/fpa_tactics.dir/fpa2bv_tactic.cpp.o.d"
+  "/root/repo/src/tactic/fpa/qffp_tactic.cpp" "src/tactic/fpa/CMakeFiles/fpa_tactics.dir/qffp_tactic.cpp.o" "gcc" "src/tactic/fpa/CMakeFiles/fpa_tactics.dir/qffp_tactic.cpp.o.d"
+  "/root/repo/src/tactic/fpa/qffplra_tactic.cpp" "src/tactic/fpa/CMakeFiles/fpa_tactics.dir/qffplra_tactic.cpp.o" "gcc" "src/tactic/fpa/CMakeFiles/fpa_tactics.dir/qffplra_tactic.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
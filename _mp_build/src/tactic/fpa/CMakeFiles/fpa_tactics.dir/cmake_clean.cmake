@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fpa_tactics.dir/fpa2bv_model_converter.cpp.o"
+  "CMakeFiles/fpa_tactics.dir/fpa2bv_model_converter.cpp.o.d"
+  "CMakeFiles/fpa_tactics.dir/fpa2bv_tactic.cpp.o"
+  "CMakeFiles/fpa_tactics.dir/fpa2bv_tactic.cpp.o.d"
+  "CMakeFiles/fpa_tactics.dir/qffp_tactic.cpp.o"
+  "CMakeFiles/fpa_tactics.dir/qffp_tactic.cpp.o.d"
+  "CMakeFiles/fpa_tactics.dir/qffplra_tactic.cpp.o"
+  "CMakeFiles/fpa_tactics.dir/qffplra_tactic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fpa_tactics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tactic/portfolio/default_tactic.cpp" "src/tactic/portfolio/CMakeFiles/portfolio.dir/default_tactic.cpp.o" "gcc" "src/tactic/portfolio/CMakeFiles/portfolio.dir/default_tactic.cpp.o.d"
+  "/root/repo/src/tactic/portfolio/smt_strategic_solver.cpp" "src/tactic/portfolio/CMakeFiles/portfolio.dir/smt_strategic_solver.cpp.o" "gcc" "src/tactic/portfolio/CMakeFiles/portfolio.dir/smt_strategic_solver.cpp.o.d"
+  "/root/repo/src/tactic/portfolio/solver2lookahead.cpp" "src/tactic/portfolio/CMakeFiles/portfolio.dir/solver2lookahead.cpp.o" "gcc" "src/tactic/portfolio/CMakeFiles/portfolio.dir/solver2lookahead.cpp.o.d"
+  "/root/repo/src/tactic/portfolio/solver_subsumption_tactic.cpp" "src/tactic/portfolio/CMakeFiles/portfolio.dir/solver_subsumption_tactic.cpp.o" "gcc" "src/tactic/portfolio/CMakeFiles/portfolio.dir/solver_subsumption_tactic.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
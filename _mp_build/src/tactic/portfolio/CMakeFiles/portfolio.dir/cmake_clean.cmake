@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/portfolio.dir/default_tactic.cpp.o"
+  "CMakeFiles/portfolio.dir/default_tactic.cpp.o.d"
+  "CMakeFiles/portfolio.dir/smt_strategic_solver.cpp.o"
+  "CMakeFiles/portfolio.dir/smt_strategic_solver.cpp.o.d"
+  "CMakeFiles/portfolio.dir/solver2lookahead.cpp.o"
+  "CMakeFiles/portfolio.dir/solver2lookahead.cpp.o.d"
+  "CMakeFiles/portfolio.dir/solver_subsumption_tactic.cpp.o"
+  "CMakeFiles/portfolio.dir/solver_subsumption_tactic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/portfolio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
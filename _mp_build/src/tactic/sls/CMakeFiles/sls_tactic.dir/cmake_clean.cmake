@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sls_tactic.dir/sls_tactic.cpp.o"
+  "CMakeFiles/sls_tactic.dir/sls_tactic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sls_tactic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tactic/smtlogics/nra_tactic.cpp" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/nra_tactic.cpp.o" "gcc" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/nra_tactic.cpp.o.d"
+  "/root/repo/src/tactic/smtlogics/qfaufbv_tactic.cpp" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfaufbv_tactic.cpp.o" "gcc" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfaufbv_tactic.cpp.o.d"
+  "/root/repo/src/tactic/smtlogics/qfauflia_tactic.cpp" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfauflia_tactic.cpp.o" "gcc" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfauflia_tactic.cpp.o.d"
+  "/root/repo/src/tactic/smtlogics/qfbv_tactic.cpp" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfbv_tactic.cpp.o" "gcc" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfbv_tactic.cpp.o.d"
+  "/root/repo/src/tactic/smtlogics/qfidl_tactic.cpp" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfidl_tactic.cpp.o" "gcc" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfidl_tactic.cpp.o.d"
+  "/root/repo/src/tactic/smtlogics/qflia_tactic.cpp" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qflia_tactic.cpp.o" "gcc" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qflia_tactic.cpp.o.d"
+  "/root/repo/src/tactic/smtlogics/qflra_tactic.cpp" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qflra_tactic.cpp.o" "gcc" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qflra_tactic.cpp.o.d"
+  "/root/repo/src/tactic/smtlogics/qfnia_tactic.cpp" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfnia_tactic.cpp.o" "gcc" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfnia_tactic.cpp.o.d"
+  "/root/repo/src/tactic/smtlogics/qfnra_tactic.cpp" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfnra_tactic.cpp.o" "gcc" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfnra_tactic.cpp.o.d"
+  "/root/repo/src/tactic/smtlogics/qfuf_tactic.cpp" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfuf_tactic.cpp.o" "gcc" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfuf_tactic.cpp.o.d"
+  "/root/repo/src/tactic/smtlogics/qfufbv_ackr_model_converter.cpp" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfufbv_ackr_model_converter.cpp.o" "gcc" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfufbv_ackr_model_converter.cpp.o.d"
+  "/root/repo/src/tactic/smtlogics/qfufbv_tactic.cpp" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfufbv_tactic.cpp.o" "gcc" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/qfufbv_tactic.cpp.o.d"
+  "/root/repo/src/tactic/smtlogics/quant_tactics.cpp" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/quant_tactics.cpp.o" "gcc" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/quant_tactics.cpp.o.d"
+  "/root/repo/src/tactic/smtlogics/smt_tactic.cpp" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/smt_tactic.cpp.o" "gcc" "src/tactic/smtlogics/CMakeFiles/smtlogic_tactics.dir/smt_tactic.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
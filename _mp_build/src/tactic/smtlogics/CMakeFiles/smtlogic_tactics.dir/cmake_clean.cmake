@@ -0,0 +1,36 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smtlogic_tactics.dir/nra_tactic.cpp.o"
+  "CMakeFiles/smtlogic_tactics.dir/nra_tactic.cpp.o.d"
+  "CMakeFiles/smtlogic_tactics.dir/qfaufbv_tactic.cpp.o"
+  "CMakeFiles/smtlogic_tactics.dir/qfaufbv_tactic.cpp.o.d"
+  "CMakeFiles/smtlogic_tactics.dir/qfauflia_tactic.cpp.o"
+  "CMakeFiles/smtlogic_tactics.dir/qfauflia_tactic.cpp.o.d"
+  "CMakeFiles/smtlogic_tactics.dir/qfbv_tactic.cpp.o"
+  "CMakeFiles/smtlogic_tactics.dir/qfbv_tactic.cpp.o.d"
+  "CMakeFiles/smtlogic_tactics.dir/qfidl_tactic.cpp.o"
+  "CMakeFiles/smtlogic_tactics.dir/qfidl_tactic.cpp.o.d"
+  "CMakeFiles/smtlogic_tactics.dir/qflia_tactic.cpp.o"
+  "CMakeFiles/smtlogic_tactics.dir/qflia_tactic.cpp.o.d"
+  "CMakeFiles/smtlogic_tactics.dir/qflra_tactic.cpp.o"
+  "CMakeFiles/smtlogic_tactics.dir/qflra_tactic.cpp.o.d"
+  "CMakeFiles/smtlogic_tactics.dir/qfnia_tactic.cpp.o"
+  "CMakeFiles/smtlogic_tactics.dir/qfnia_tactic.cpp.o.d"
+  "CMakeFiles/smtlogic_tactics.dir/qfnra_tactic.cpp.o"
+  "CMakeFiles/smtlogic_tactics.dir/qfnra_tactic.cpp.o.d"
+  "CMakeFiles/smtlogic_tactics.dir/qfuf_tactic.cpp.o"
+  "CMakeFiles/smtlogic_tactics.dir/qfuf_tactic.cpp.o.d"
+  "CMakeFiles/smtlogic_tactics.dir/qfufbv_ackr_model_converter.cpp.o"
+  "CMakeFiles/smtlogic_tactics.dir/qfufbv_ackr_model_converter.cpp.o.d"
+  "CMakeFiles/smtlogic_tactics.dir/qfufbv_tactic.cpp.o"
+  "CMakeFiles/smtlogic_tactics.dir/qfufbv_tactic.cpp.o.d"
+  "CMakeFiles/smtlogic_tactics.dir/quant_tactics.cpp.o"
+  "CMakeFiles/smtlogic_tactics.dir/quant_tactics.cpp.o.d"
+  "CMakeFiles/smtlogic_tactics.dir/smt_tactic.cpp.o"
+  "CMakeFiles/smtlogic_tactics.dir/smt_tactic.cpp.o.d"
+  "qfufbv_tactic_params.hpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smtlogic_tactics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
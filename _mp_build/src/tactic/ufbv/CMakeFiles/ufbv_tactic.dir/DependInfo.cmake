@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tactic/ufbv/macro_finder_tactic.cpp" "src/tactic/ufbv/CMakeFiles/ufbv_tactic.dir/macro_finder_tactic.cpp.o" "gcc" "src/tactic/ufbv/CMakeFiles/ufbv_tactic.dir/macro_finder_tactic.cpp.o.d"
+  "/root/repo/src/tactic/ufbv/quasi_macros_tactic.cpp" "src/tactic/ufbv/CMakeFiles/ufbv_tactic.dir/quasi_macros_tactic.cpp.o" "gcc" "src/tactic/ufbv/CMakeFiles/ufbv_tactic.dir/quasi_macros_tactic.cpp.o.d"
+  "/root/repo/src/tactic/ufbv/ufbv_rewriter_tactic.cpp" "src/tactic/ufbv/CMakeFiles/ufbv_tactic.dir/ufbv_rewriter_tactic.cpp.o" "gcc" "src/tactic/ufbv/CMakeFiles/ufbv_tactic.dir/ufbv_rewriter_tactic.cpp.o.d"
+  "/root/repo/src/tactic/ufbv/ufbv_tactic.cpp" "src/tactic/ufbv/CMakeFiles/ufbv_tactic.dir/ufbv_tactic.cpp.o" "gcc" "src/tactic/ufbv/CMakeFiles/ufbv_tactic.dir/ufbv_tactic.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
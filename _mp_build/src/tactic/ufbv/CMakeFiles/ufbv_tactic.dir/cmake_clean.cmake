@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ufbv_tactic.dir/macro_finder_tactic.cpp.o"
+  "CMakeFiles/ufbv_tactic.dir/macro_finder_tactic.cpp.o.d"
+  "CMakeFiles/ufbv_tactic.dir/quasi_macros_tactic.cpp.o"
+  "CMakeFiles/ufbv_tactic.dir/quasi_macros_tactic.cpp.o.d"
+  "CMakeFiles/ufbv_tactic.dir/ufbv_rewriter_tactic.cpp.o"
+  "CMakeFiles/ufbv_tactic.dir/ufbv_rewriter_tactic.cpp.o.d"
+  "CMakeFiles/ufbv_tactic.dir/ufbv_tactic.cpp.o"
+  "CMakeFiles/ufbv_tactic.dir/ufbv_tactic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ufbv_tactic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,158 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/test/aig_synth.cpp" "src/test/CMakeFiles/test-z3.dir/aig_synth.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/aig_synth.cpp.o.d"
+  "/root/repo/src/test/algebraic.cpp" "src/test/CMakeFiles/test-z3.dir/algebraic.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/algebraic.cpp.o.d"
+  "/root/repo/src/test/api.cpp" "src/test/CMakeFiles/test-z3.dir/api.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/api.cpp.o.d"
+  "/root/repo/src/test/api_bug.cpp" "src/test/CMakeFiles/test-z3.dir/api_bug.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/api_bug.cpp.o.d"
+  "/root/repo/src/test/arith_rewriter.cpp" "src/test/CMakeFiles/test-z3.dir/arith_rewriter.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/arith_rewriter.cpp.o.d"
+  "/root/repo/src/test/arith_simplifier_plugin.cpp" "src/test/CMakeFiles/test-z3.dir/arith_simplifier_plugin.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/arith_simplifier_plugin.cpp.o.d"
+  "/root/repo/src/test/ast.cpp" "src/test/CMakeFiles/test-z3.dir/ast.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/ast.cpp.o.d"
+  "/root/repo/src/test/bdd.cpp" "src/test/CMakeFiles/test-z3.dir/bdd.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/bdd.cpp.o.d"
+  "/root/repo/src/test/bit_blaster.cpp" "src/test/CMakeFiles/test-z3.dir/bit_blaster.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/bit_blaster.cpp.o.d"
+  "/root/repo/src/test/bit_vector.cpp" "src/test/CMakeFiles/test-z3.dir/bit_vector.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/bit_vector.cpp.o.d"
+  "/root/repo/src/test/bits.cpp" "src/test/CMakeFiles/test-z3.dir/bits.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/bits.cpp.o.d"
+  "/root/repo/src/test/buffer.cpp" "src/test/CMakeFiles/test-z3.dir/buffer.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/buffer.cpp.o.d"
+  "/root/repo/src/test/bv_delay.cpp" "src/test/CMakeFiles/test-z3.dir/bv_delay.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/bv_delay.cpp.o.d"
+  "/root/repo/src/test/char_set.cpp" "src/test/CMakeFiles/test-z3.dir/char_set.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/char_set.cpp.o.d"
+  "/root/repo/src/test/chashtable.cpp" "src/test/CMakeFiles/test-z3.dir/chashtable.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/chashtable.cpp.o.d"
+  "/root/repo/src/test/check_assumptions.cpp" "src/test/CMakeFiles/test-z3.dir/check_assumptions.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/check_assumptions.cpp.o.d"
+  "/root/repo/src/test/cnf_backbones.cpp" "src/test/CMakeFiles/test-z3.dir/cnf_backbones.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/cnf_backbones.cpp.o.d"
+  "/root/repo/src/test/cube_clause.cpp" "src/test/CMakeFiles/test-z3.dir/cube_clause.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/cube_clause.cpp.o.d"
+  "/root/repo/src/test/datalog_parser.cpp" "src/test/CMakeFiles/test-z3.dir/datalog_parser.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/datalog_parser.cpp.o.d"
+  "/root/repo/src/test/ddnf.cpp" "src/test/CMakeFiles/test-z3.dir/ddnf.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/ddnf.cpp.o.d"
+  "/root/repo/src/test/diff_logic.cpp" "src/test/CMakeFiles/test-z3.dir/diff_logic.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/diff_logic.cpp.o.d"
+  "/root/repo/src/test/distribution.cpp" "src/test/CMakeFiles/test-z3.dir/distribution.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/distribution.cpp.o.d"
+  "/root/repo/src/test/dl_context.cpp" "src/test/CMakeFiles/test-z3.dir/dl_context.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/dl_context.cpp.o.d"
+  "/root/repo/src/test/dl_product_relation.cpp" "src/test/CMakeFiles/test-z3.dir/dl_product_relation.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/dl_product_relation.cpp.o.d"
+  "/root/repo/src/test/dl_query.cpp" "src/test/CMakeFiles/test-z3.dir/dl_query.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/dl_query.cpp.o.d"
+  "/root/repo/src/test/dl_relation.cpp" "src/test/CMakeFiles/test-z3.dir/dl_relation.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/dl_relation.cpp.o.d"
+  "/root/repo/src/test/dl_table.cpp" "src/test/CMakeFiles/test-z3.dir/dl_table.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/dl_table.cpp.o.d"
+  "/root/repo/src/test/dl_util.cpp" "src/test/CMakeFiles/test-z3.dir/dl_util.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/dl_util.cpp.o.d"
+  "/root/repo/src/test/dlist.cpp" "src/test/CMakeFiles/test-z3.dir/dlist.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/dlist.cpp.o.d"
+  "/root/repo/src/test/doc.cpp" "src/test/CMakeFiles/test-z3.dir/doc.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/doc.cpp.o.d"
+  "/root/repo/src/test/egraph.cpp" "src/test/CMakeFiles/test-z3.dir/egraph.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/egraph.cpp.o.d"
+  "/root/repo/src/test/escaped.cpp" "src/test/CMakeFiles/test-z3.dir/escaped.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/escaped.cpp.o.d"
+  "/root/repo/src/test/euf_arith_plugin.cpp" "src/test/CMakeFiles/test-z3.dir/euf_arith_plugin.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/euf_arith_plugin.cpp.o.d"
+  "/root/repo/src/test/euf_bv_plugin.cpp" "src/test/CMakeFiles/test-z3.dir/euf_bv_plugin.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/euf_bv_plugin.cpp.o.d"
+  "/root/repo/src/test/ex.cpp" "src/test/CMakeFiles/test-z3.dir/ex.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/ex.cpp.o.d"
+  "/root/repo/src/test/expr_rand.cpp" "src/test/CMakeFiles/test-z3.dir/expr_rand.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/expr_rand.cpp.o.d"
+  "/root/repo/src/test/expr_substitution.cpp" "src/test/CMakeFiles/test-z3.dir/expr_substitution.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/expr_substitution.cpp.o.d"
+  "/root/repo/src/test/ext_numeral.cpp" "src/test/CMakeFiles/test-z3.dir/ext_numeral.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/ext_numeral.cpp.o.d"
+  "/root/repo/src/test/f2n.cpp" "src/test/CMakeFiles/test-z3.dir/f2n.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/f2n.cpp.o.d"
+  "/root/repo/src/test/factor_rewriter.cpp" "src/test/CMakeFiles/test-z3.dir/factor_rewriter.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/factor_rewriter.cpp.o.d"
+  "/root/repo/src/test/finder.cpp" "src/test/CMakeFiles/test-z3.dir/finder.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/finder.cpp.o.d"
+  "/root/repo/src/test/fixed_bit_vector.cpp" "src/test/CMakeFiles/test-z3.dir/fixed_bit_vector.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/fixed_bit_vector.cpp.o.d"
+  "/root/repo/src/test/for_each_file.cpp" "src/test/CMakeFiles/test-z3.dir/for_each_file.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/for_each_file.cpp.o.d"
+  "/root/repo/src/test/get_consequences.cpp" "src/test/CMakeFiles/test-z3.dir/get_consequences.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/get_consequences.cpp.o.d"
+  "/root/repo/src/test/get_implied_equalities.cpp" "src/test/CMakeFiles/test-z3.dir/get_implied_equalities.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/get_implied_equalities.cpp.o.d"
+  "/root/repo/_mp_build/src/test/gparams_register_modules.cpp" "src/test/CMakeFiles/test-z3.dir/gparams_register_modules.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/gparams_register_modules.cpp.o.d"
+  "/root/repo/src/test/hashtable.cpp" "src/test/CMakeFiles/test-z3.dir/hashtable.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/hashtable.cpp.o.d"
+  "/root/repo/src/test/heap.cpp" "src/test/CMakeFiles/test-z3.dir/heap.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/heap.cpp.o.d"
+  "/root/repo/src/test/heap_trie.cpp" "src/test/CMakeFiles/test-z3.dir/heap_trie.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/heap_trie.cpp.o.d"
+  "/root/repo/src/test/hilbert_basis.cpp" "src/test/CMakeFiles/test-z3.dir/hilbert_basis.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/hilbert_basis.cpp.o.d"
+  "/root/repo/src/test/horn_subsume_model_converter.cpp" "src/test/CMakeFiles/test-z3.dir/horn_subsume_model_converter.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/horn_subsume_model_converter.cpp.o.d"
+  "/root/repo/src/test/hwf.cpp" "src/test/CMakeFiles/test-z3.dir/hwf.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/hwf.cpp.o.d"
+  "/root/repo/src/test/inf_rational.cpp" "src/test/CMakeFiles/test-z3.dir/inf_rational.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/inf_rational.cpp.o.d"
+  "/root/repo/_mp_build/src/test/install_tactic.cpp" "src/test/CMakeFiles/test-z3.dir/install_tactic.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/install_tactic.cpp.o.d"
+  "/root/repo/src/test/interval.cpp" "src/test/CMakeFiles/test-z3.dir/interval.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/interval.cpp.o.d"
+  "/root/repo/src/test/karr.cpp" "src/test/CMakeFiles/test-z3.dir/karr.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/karr.cpp.o.d"
+  "/root/repo/src/test/list.cpp" "src/test/CMakeFiles/test-z3.dir/list.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/list.cpp.o.d"
+  "/root/repo/src/test/lp/lp.cpp" "src/test/CMakeFiles/test-z3.dir/lp/lp.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/lp/lp.cpp.o.d"
+  "/root/repo/src/test/lp/nla_solver_test.cpp" "src/test/CMakeFiles/test-z3.dir/lp/nla_solver_test.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/lp/nla_solver_test.cpp.o.d"
+  "/root/repo/src/test/main.cpp" "src/test/CMakeFiles/test-z3.dir/main.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/main.cpp.o.d"
+  "/root/repo/src/test/map.cpp" "src/test/CMakeFiles/test-z3.dir/map.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/map.cpp.o.d"
+  "/root/repo/src/test/matcher.cpp" "src/test/CMakeFiles/test-z3.dir/matcher.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/matcher.cpp.o.d"
+  "/root/repo/src/test/mbp_cache.cpp" "src/test/CMakeFiles/test-z3.dir/mbp_cache.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/mbp_cache.cpp.o.d"
+  "/root/repo/_mp_build/src/test/mem_initializer.cpp" "src/test/CMakeFiles/test-z3.dir/mem_initializer.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/mem_initializer.cpp.o.d"
+  "/root/repo/src/test/memory.cpp" "src/test/CMakeFiles/test-z3.dir/memory.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/memory.cpp.o.d"
+  "/root/repo/src/test/memory_profile.cpp" "src/test/CMakeFiles/test-z3.dir/memory_profile.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/memory_profile.cpp.o.d"
+  "/root/repo/src/test/model2expr.cpp" "src/test/CMakeFiles/test-z3.dir/model2expr.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/model2expr.cpp.o.d"
+  "/root/repo/src/test/model_based_opt.cpp" "src/test/CMakeFiles/test-z3.dir/model_based_opt.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/model_based_opt.cpp.o.d"
+  "/root/repo/src/test/model_evaluator.cpp" "src/test/CMakeFiles/test-z3.dir/model_evaluator.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/model_evaluator.cpp.o.d"
+  "/root/repo/src/test/model_retrieval.cpp" "src/test/CMakeFiles/test-z3.dir/model_retrieval.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/model_retrieval.cpp.o.d"
+  "/root/repo/src/test/mpbq.cpp" "src/test/CMakeFiles/test-z3.dir/mpbq.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/mpbq.cpp.o.d"
+  "/root/repo/src/test/mpf.cpp" "src/test/CMakeFiles/test-z3.dir/mpf.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/mpf.cpp.o.d"
+  "/root/repo/src/test/mpff.cpp" "src/test/CMakeFiles/test-z3.dir/mpff.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/mpff.cpp.o.d"
+  "/root/repo/src/test/mpfx.cpp" "src/test/CMakeFiles/test-z3.dir/mpfx.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/mpfx.cpp.o.d"
+  "/root/repo/src/test/mpq.cpp" "src/test/CMakeFiles/test-z3.dir/mpq.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/mpq.cpp.o.d"
+  "/root/repo/src/test/mpz.cpp" "src/test/CMakeFiles/test-z3.dir/mpz.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/mpz.cpp.o.d"
+  "/root/repo/src/test/nlarith_util.cpp" "src/test/CMakeFiles/test-z3.dir/nlarith_util.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/nlarith_util.cpp.o.d"
+  "/root/repo/src/test/nlsat.cpp" "src/test/CMakeFiles/test-z3.dir/nlsat.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/nlsat.cpp.o.d"
+  "/root/repo/src/test/no_overflow.cpp" "src/test/CMakeFiles/test-z3.dir/no_overflow.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/no_overflow.cpp.o.d"
+  "/root/repo/src/test/object_allocator.cpp" "src/test/CMakeFiles/test-z3.dir/object_allocator.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/object_allocator.cpp.o.d"
+  "/root/repo/src/test/old_interval.cpp" "src/test/CMakeFiles/test-z3.dir/old_interval.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/old_interval.cpp.o.d"
+  "/root/repo/src/test/opt_parallel_cores.cpp" "src/test/CMakeFiles/test-z3.dir/opt_parallel_cores.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/opt_parallel_cores.cpp.o.d"
+  "/root/repo/src/test/optional.cpp" "src/test/CMakeFiles/test-z3.dir/optional.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/optional.cpp.o.d"
+  "/root/repo/src/test/parallel_pool.cpp" "src/test/CMakeFiles/test-z3.dir/parallel_pool.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/parallel_pool.cpp.o.d"
+  "/root/repo/src/test/parallel_simplifier.cpp" "src/test/CMakeFiles/test-z3.dir/parallel_simplifier.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/parallel_simplifier.cpp.o.d"
+  "/root/repo/src/test/parray.cpp" "src/test/CMakeFiles/test-z3.dir/parray.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/parray.cpp.o.d"
+  "/root/repo/src/test/pb2bv.cpp" "src/test/CMakeFiles/test-z3.dir/pb2bv.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/pb2bv.cpp.o.d"
+  "/root/repo/src/test/pdd.cpp" "src/test/CMakeFiles/test-z3.dir/pdd.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/pdd.cpp.o.d"
+  "/root/repo/src/test/pdd_solver.cpp" "src/test/CMakeFiles/test-z3.dir/pdd_solver.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/pdd_solver.cpp.o.d"
+  "/root/repo/src/test/permutation.cpp" "src/test/CMakeFiles/test-z3.dir/permutation.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/permutation.cpp.o.d"
+  "/root/repo/src/test/polynomial.cpp" "src/test/CMakeFiles/test-z3.dir/polynomial.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/polynomial.cpp.o.d"
+  "/root/repo/src/test/polynorm.cpp" "src/test/CMakeFiles/test-z3.dir/polynorm.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/polynorm.cpp.o.d"
+  "/root/repo/src/test/prime_generator.cpp" "src/test/CMakeFiles/test-z3.dir/prime_generator.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/prime_generator.cpp.o.d"
+  "/root/repo/src/test/proof_checker.cpp" "src/test/CMakeFiles/test-z3.dir/proof_checker.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/proof_checker.cpp.o.d"
+  "/root/repo/src/test/qe_arith.cpp" "src/test/CMakeFiles/test-z3.dir/qe_arith.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/qe_arith.cpp.o.d"
+  "/root/repo/src/test/quant_elim.cpp" "src/test/CMakeFiles/test-z3.dir/quant_elim.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/quant_elim.cpp.o.d"
+  "/root/repo/src/test/quant_solve.cpp" "src/test/CMakeFiles/test-z3.dir/quant_solve.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/quant_solve.cpp.o.d"
+  "/root/repo/src/test/random.cpp" "src/test/CMakeFiles/test-z3.dir/random.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/random.cpp.o.d"
+  "/root/repo/src/test/rational.cpp" "src/test/CMakeFiles/test-z3.dir/rational.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/rational.cpp.o.d"
+  "/root/repo/src/test/rcf.cpp" "src/test/CMakeFiles/test-z3.dir/rcf.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/rcf.cpp.o.d"
+  "/root/repo/src/test/region.cpp" "src/test/CMakeFiles/test-z3.dir/region.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/region.cpp.o.d"
+  "/root/repo/src/test/sat_circuit.cpp" "src/test/CMakeFiles/test-z3.dir/sat_circuit.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/sat_circuit.cpp.o.d"
+  "/root/repo/src/test/sat_local_search.cpp" "src/test/CMakeFiles/test-z3.dir/sat_local_search.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/sat_local_search.cpp.o.d"
+  "/root/repo/src/test/sat_lookahead.cpp" "src/test/CMakeFiles/test-z3.dir/sat_lookahead.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/sat_lookahead.cpp.o.d"
+  "/root/repo/src/test/sat_user_scope.cpp" "src/test/CMakeFiles/test-z3.dir/sat_user_scope.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/sat_user_scope.cpp.o.d"
+  "/root/repo/src/test/scoped_timer.cpp" "src/test/CMakeFiles/test-z3.dir/scoped_timer.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/scoped_timer.cpp.o.d"
+  "/root/repo/src/test/scoped_vector.cpp" "src/test/CMakeFiles/test-z3.dir/scoped_vector.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/scoped_vector.cpp.o.d"
+  "/root/repo/src/test/seq_dfa.cpp" "src/test/CMakeFiles/test-z3.dir/seq_dfa.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/seq_dfa.cpp.o.d"
+  "/root/repo/src/test/simple_parser.cpp" "src/test/CMakeFiles/test-z3.dir/simple_parser.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/simple_parser.cpp.o.d"
+  "/root/repo/src/test/simplex.cpp" "src/test/CMakeFiles/test-z3.dir/simplex.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/simplex.cpp.o.d"
+  "/root/repo/src/test/simplifier.cpp" "src/test/CMakeFiles/test-z3.dir/simplifier.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/simplifier.cpp.o.d"
+  "/root/repo/src/test/sls_seq_plugin.cpp" "src/test/CMakeFiles/test-z3.dir/sls_seq_plugin.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/sls_seq_plugin.cpp.o.d"
+  "/root/repo/src/test/sls_test.cpp" "src/test/CMakeFiles/test-z3.dir/sls_test.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/sls_test.cpp.o.d"
+  "/root/repo/src/test/small_object_allocator.cpp" "src/test/CMakeFiles/test-z3.dir/small_object_allocator.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/small_object_allocator.cpp.o.d"
+  "/root/repo/src/test/smt2print_parse.cpp" "src/test/CMakeFiles/test-z3.dir/smt2print_parse.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/smt2print_parse.cpp.o.d"
+  "/root/repo/src/test/smt_context.cpp" "src/test/CMakeFiles/test-z3.dir/smt_context.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/smt_context.cpp.o.d"
+  "/root/repo/src/test/solver_pool.cpp" "src/test/CMakeFiles/test-z3.dir/solver_pool.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/solver_pool.cpp.o.d"
+  "/root/repo/src/test/sorting_network.cpp" "src/test/CMakeFiles/test-z3.dir/sorting_network.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/sorting_network.cpp.o.d"
+  "/root/repo/src/test/spacer_lemma.cpp" "src/test/CMakeFiles/test-z3.dir/spacer_lemma.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/spacer_lemma.cpp.o.d"
+  "/root/repo/src/test/stack.cpp" "src/test/CMakeFiles/test-z3.dir/stack.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/stack.cpp.o.d"
+  "/root/repo/src/test/string_buffer.cpp" "src/test/CMakeFiles/test-z3.dir/string_buffer.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/string_buffer.cpp.o.d"
+  "/root/repo/src/test/substitution.cpp" "src/test/CMakeFiles/test-z3.dir/substitution.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/substitution.cpp.o.d"
+  "/root/repo/src/test/symbol.cpp" "src/test/CMakeFiles/test-z3.dir/symbol.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/symbol.cpp.o.d"
+  "/root/repo/src/test/symbol_table.cpp" "src/test/CMakeFiles/test-z3.dir/symbol_table.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/symbol_table.cpp.o.d"
+  "/root/repo/src/test/tbv.cpp" "src/test/CMakeFiles/test-z3.dir/tbv.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/tbv.cpp.o.d"
+  "/root/repo/src/test/theory_dl.cpp" "src/test/CMakeFiles/test-z3.dir/theory_dl.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/theory_dl.cpp.o.d"
+  "/root/repo/src/test/theory_pb.cpp" "src/test/CMakeFiles/test-z3.dir/theory_pb.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/theory_pb.cpp.o.d"
+  "/root/repo/src/test/thread_cache_allocator.cpp" "src/test/CMakeFiles/test-z3.dir/thread_cache_allocator.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/thread_cache_allocator.cpp.o.d"
+  "/root/repo/src/test/timeout.cpp" "src/test/CMakeFiles/test-z3.dir/timeout.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/timeout.cpp.o.d"
+  "/root/repo/src/test/total_order.cpp" "src/test/CMakeFiles/test-z3.dir/total_order.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/total_order.cpp.o.d"
+  "/root/repo/src/test/totalizer.cpp" "src/test/CMakeFiles/test-z3.dir/totalizer.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/totalizer.cpp.o.d"
+  "/root/repo/src/test/trigo.cpp" "src/test/CMakeFiles/test-z3.dir/trigo.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/trigo.cpp.o.d"
+  "/root/repo/src/test/udoc_relation.cpp" "src/test/CMakeFiles/test-z3.dir/udoc_relation.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/udoc_relation.cpp.o.d"
+  "/root/repo/src/test/uint_set.cpp" "src/test/CMakeFiles/test-z3.dir/uint_set.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/uint_set.cpp.o.d"
+  "/root/repo/src/test/upolynomial.cpp" "src/test/CMakeFiles/test-z3.dir/upolynomial.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/upolynomial.cpp.o.d"
+  "/root/repo/src/test/value_generator.cpp" "src/test/CMakeFiles/test-z3.dir/value_generator.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/value_generator.cpp.o.d"
+  "/root/repo/src/test/value_sweep.cpp" "src/test/CMakeFiles/test-z3.dir/value_sweep.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/value_sweep.cpp.o.d"
+  "/root/repo/src/test/var_subst.cpp" "src/test/CMakeFiles/test-z3.dir/var_subst.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/var_subst.cpp.o.d"
+  "/root/repo/src/test/vector.cpp" "src/test/CMakeFiles/test-z3.dir/vector.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/vector.cpp.o.d"
+  "/root/repo/src/test/zstring.cpp" "src/test/CMakeFiles/test-z3.dir/zstring.cpp.o" "gcc" "src/test/CMakeFiles/test-z3.dir/zstring.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
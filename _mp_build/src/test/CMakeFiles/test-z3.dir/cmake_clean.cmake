@@ -0,0 +1,292 @@
+file(REMOVE_RECURSE
+  "../../test-z3"
+  "../../test-z3.pdb"
+  "CMakeFiles/test-z3.dir/aig_synth.cpp.o"
+  "CMakeFiles/test-z3.dir/aig_synth.cpp.o.d"
+  "CMakeFiles/test-z3.dir/algebraic.cpp.o"
+  "CMakeFiles/test-z3.dir/algebraic.cpp.o.d"
+  "CMakeFiles/test-z3.dir/api.cpp.o"
+  "CMakeFiles/test-z3.dir/api.cpp.o.d"
+  "CMakeFiles/test-z3.dir/api_bug.cpp.o"
+  "CMakeFiles/test-z3.dir/api_bug.cpp.o.d"
+  "CMakeFiles/test-z3.dir/arith_rewriter.cpp.o"
+  "CMakeFiles/test-z3.dir/arith_rewriter.cpp.o.d"
+  "CMakeFiles/test-z3.dir/arith_simplifier_plugin.cpp.o"
+  "CMakeFiles/test-z3.dir/arith_simplifier_plugin.cpp.o.d"
+  "CMakeFiles/test-z3.dir/ast.cpp.o"
+  "CMakeFiles/test-z3.dir/ast.cpp.o.d"
+  "CMakeFiles/test-z3.dir/bdd.cpp.o"
+  "CMakeFiles/test-z3.dir/bdd.cpp.o.d"
+  "CMakeFiles/test-z3.dir/bit_blaster.cpp.o"
+  "CMakeFiles/test-z3.dir/bit_blaster.cpp.o.d"
+  "CMakeFiles/test-z3.dir/bit_vector.cpp.o"
+  "CMakeFiles/test-z3.dir/bit_vector.cpp.o.d"
+  "CMakeFiles/test-z3.dir/bits.cpp.o"
+  "CMakeFiles/test-z3.dir/bits.cpp.o.d"
+  "CMakeFiles/test-z3.dir/buffer.cpp.o"
+  "CMakeFiles/test-z3.dir/buffer.cpp.o.d"
+  "CMakeFiles/test-z3.dir/bv_delay.cpp.o"
+  "CMakeFiles/test-z3.dir/bv_delay.cpp.o.d"
+  "CMakeFiles/test-z3.dir/char_set.cpp.o"
+  "CMakeFiles/test-z3.dir/char_set.cpp.o.d"
+  "CMakeFiles/test-z3.dir/chashtable.cpp.o"
+  "CMakeFiles/test-z3.dir/chashtable.cpp.o.d"
+  "CMakeFiles/test-z3.dir/check_assumptions.cpp.o"
+  "CMakeFiles/test-z3.dir/check_assumptions.cpp.o.d"
+  "CMakeFiles/test-z3.dir/cnf_backbones.cpp.o"
+  "CMakeFiles/test-z3.dir/cnf_backbones.cpp.o.d"
+  "CMakeFiles/test-z3.dir/cube_clause.cpp.o"
+  "CMakeFiles/test-z3.dir/cube_clause.cpp.o.d"
+  "CMakeFiles/test-z3.dir/datalog_parser.cpp.o"
+  "CMakeFiles/test-z3.dir/datalog_parser.cpp.o.d"
+  "CMakeFiles/test-z3.dir/ddnf.cpp.o"
+  "CMakeFiles/test-z3.dir/ddnf.cpp.o.d"
+  "CMakeFiles/test-z3.dir/diff_logic.cpp.o"
+  "CMakeFiles/test-z3.dir/diff_logic.cpp.o.d"
+  "CMakeFiles/test-z3.dir/distribution.cpp.o"
+  "CMakeFiles/test-z3.dir/distribution.cpp.o.d"
+  "CMakeFiles/test-z3.dir/dl_context.cpp.o"
+  "CMakeFiles/test-z3.dir/dl_context.cpp.o.d"
+  "CMakeFiles/test-z3.dir/dl_product_relation.cpp.o"
+  "CMakeFiles/test-z3.dir/dl_product_relation.cpp.o.d"
+  "CMakeFiles/test-z3.dir/dl_query.cpp.o"
+  "CMakeFiles/test-z3.dir/dl_query.cpp.o.d"
+  "CMakeFiles/test-z3.dir/dl_relation.cpp.o"
+  "CMakeFiles/test-z3.dir/dl_relation.cpp.o.d"
+  "CMakeFiles/test-z3.dir/dl_table.cpp.o"
+  "CMakeFiles/test-z3.dir/dl_table.cpp.o.d"
+  "CMakeFiles/test-z3.dir/dl_util.cpp.o"
+  "CMakeFiles/test-z3.dir/dl_util.cpp.o.d"
+  "CMakeFiles/test-z3.dir/dlist.cpp.o"
+  "CMakeFiles/test-z3.dir/dlist.cpp.o.d"
+  "CMakeFiles/test-z3.dir/doc.cpp.o"
+  "CMakeFiles/test-z3.dir/doc.cpp.o.d"
+  "CMakeFiles/test-z3.dir/egraph.cpp.o"
+  "CMakeFiles/test-z3.dir/egraph.cpp.o.d"
+  "CMakeFiles/test-z3.dir/escaped.cpp.o"
+  "CMakeFiles/test-z3.dir/escaped.cpp.o.d"
+  "CMakeFiles/test-z3.dir/euf_arith_plugin.cpp.o"
+  "CMakeFiles/test-z3.dir/euf_arith_plugin.cpp.o.d"
+  "CMakeFiles/test-z3.dir/euf_bv_plugin.cpp.o"
+  "CMakeFiles/test-z3.dir/euf_bv_plugin.cpp.o.d"
+  "CMakeFiles/test-z3.dir/ex.cpp.o"
+  "CMakeFiles/test-z3.dir/ex.cpp.o.d"
+  "CMakeFiles/test-z3.dir/expr_rand.cpp.o"
+  "CMakeFiles/test-z3.dir/expr_rand.cpp.o.d"
+  "CMakeFiles/test-z3.dir/expr_substitution.cpp.o"
+  "CMakeFiles/test-z3.dir/expr_substitution.cpp.o.d"
+  "CMakeFiles/test-z3.dir/ext_numeral.cpp.o"
+  "CMakeFiles/test-z3.dir/ext_numeral.cpp.o.d"
+  "CMakeFiles/test-z3.dir/f2n.cpp.o"
+  "CMakeFiles/test-z3.dir/f2n.cpp.o.d"
+  "CMakeFiles/test-z3.dir/factor_rewriter.cpp.o"
+  "CMakeFiles/test-z3.dir/factor_rewriter.cpp.o.d"
+  "CMakeFiles/test-z3.dir/finder.cpp.o"
+  "CMakeFiles/test-z3.dir/finder.cpp.o.d"
+  "CMakeFiles/test-z3.dir/fixed_bit_vector.cpp.o"
+  "CMakeFiles/test-z3.dir/fixed_bit_vector.cpp.o.d"
+  "CMakeFiles/test-z3.dir/for_each_file.cpp.o"
+  "CMakeFiles/test-z3.dir/for_each_file.cpp.o.d"
+  "CMakeFiles/test-z3.dir/get_consequences.cpp.o"
+  "CMakeFiles/test-z3.dir/get_consequences.cpp.o.d"
+  "CMakeFiles/test-z3.dir/get_implied_equalities.cpp.o"
+  "CMakeFiles/test-z3.dir/get_implied_equalities.cpp.o.d"
+  "CMakeFiles/test-z3.dir/gparams_register_modules.cpp.o"
+  "CMakeFiles/test-z3.dir/gparams_register_modules.cpp.o.d"
+  "CMakeFiles/test-z3.dir/hashtable.cpp.o"
+  "CMakeFiles/test-z3.dir/hashtable.cpp.o.d"
+  "CMakeFiles/test-z3.dir/heap.cpp.o"
+  "CMakeFiles/test-z3.dir/heap.cpp.o.d"
+  "CMakeFiles/test-z3.dir/heap_trie.cpp.o"
+  "CMakeFiles/test-z3.dir/heap_trie.cpp.o.d"
+  "CMakeFiles/test-z3.dir/hilbert_basis.cpp.o"
+  "CMakeFiles/test-z3.dir/hilbert_basis.cpp.o.d"
+  "CMakeFiles/test-z3.dir/horn_subsume_model_converter.cpp.o"
+  "CMakeFiles/test-z3.dir/horn_subsume_model_converter.cpp.o.d"
+  "CMakeFiles/test-z3.dir/hwf.cpp.o"
+  "CMakeFiles/test-z3.dir/hwf.cpp.o.d"
+  "CMakeFiles/test-z3.dir/inf_rational.cpp.o"
+  "CMakeFiles/test-z3.dir/inf_rational.cpp.o.d"
+  "CMakeFiles/test-z3.dir/install_tactic.cpp.o"
+  "CMakeFiles/test-z3.dir/install_tactic.cpp.o.d"
+  "CMakeFiles/test-z3.dir/interval.cpp.o"
+  "CMakeFiles/test-z3.dir/interval.cpp.o.d"
+  "CMakeFiles/test-z3.dir/karr.cpp.o"
+  "CMakeFiles/test-z3.dir/karr.cpp.o.d"
+  "CMakeFiles/test-z3.dir/list.cpp.o"
+  "CMakeFiles/test-z3.dir/list.cpp.o.d"
+  "CMakeFiles/test-z3.dir/lp/lp.cpp.o"
+  "CMakeFiles/test-z3.dir/lp/lp.cpp.o.d"
+  "CMakeFiles/test-z3.dir/lp/nla_solver_test.cpp.o"
+  "CMakeFiles/test-z3.dir/lp/nla_solver_test.cpp.o.d"
+  "CMakeFiles/test-z3.dir/main.cpp.o"
+  "CMakeFiles/test-z3.dir/main.cpp.o.d"
+  "CMakeFiles/test-z3.dir/map.cpp.o"
+  "CMakeFiles/test-z3.dir/map.cpp.o.d"
+  "CMakeFiles/test-z3.dir/matcher.cpp.o"
+  "CMakeFiles/test-z3.dir/matcher.cpp.o.d"
+  "CMakeFiles/test-z3.dir/mbp_cache.cpp.o"
+  "CMakeFiles/test-z3.dir/mbp_cache.cpp.o.d"
+  "CMakeFiles/test-z3.dir/mem_initializer.cpp.o"
+  "CMakeFiles/test-z3.dir/mem_initializer.cpp.o.d"
+  "CMakeFiles/test-z3.dir/memory.cpp.o"
+  "CMakeFiles/test-z3.dir/memory.cpp.o.d"
+  "CMakeFiles/test-z3.dir/memory_profile.cpp.o"
+  "CMakeFiles/test-z3.dir/memory_profile.cpp.o.d"
+  "CMakeFiles/test-z3.dir/model2expr.cpp.o"
+  "CMakeFiles/test-z3.dir/model2expr.cpp.o.d"
+  "CMakeFiles/test-z3.dir/model_based_opt.cpp.o"
+  "CMakeFiles/test-z3.dir/model_based_opt.cpp.o.d"
+  "CMakeFiles/test-z3.dir/model_evaluator.cpp.o"
+  "CMakeFiles/test-z3.dir/model_evaluator.cpp.o.d"
+  "CMakeFiles/test-z3.dir/model_retrieval.cpp.o"
+  "CMakeFiles/test-z3.dir/model_retrieval.cpp.o.d"
+  "CMakeFiles/test-z3.dir/mpbq.cpp.o"
+  "CMakeFiles/test-z3.dir/mpbq.cpp.o.d"
+  "CMakeFiles/test-z3.dir/mpf.cpp.o"
+  "CMakeFiles/test-z3.dir/mpf.cpp.o.d"
+  "CMakeFiles/test-z3.dir/mpff.cpp.o"
+  "CMakeFiles/test-z3.dir/mpff.cpp.o.d"
+  "CMakeFiles/test-z3.dir/mpfx.cpp.o"
+  "CMakeFiles/test-z3.dir/mpfx.cpp.o.d"
+  "CMakeFiles/test-z3.dir/mpq.cpp.o"
+  "CMakeFiles/test-z3.dir/mpq.cpp.o.d"
+  "CMakeFiles/test-z3.dir/mpz.cpp.o"
+  "CMakeFiles/test-z3.dir/mpz.cpp.o.d"
+  "CMakeFiles/test-z3.dir/nlarith_util.cpp.o"
+  "CMakeFiles/test-z3.dir/nlarith_util.cpp.o.d"
+  "CMakeFiles/test-z3.dir/nlsat.cpp.o"
+  "CMakeFiles/test-z3.dir/nlsat.cpp.o.d"
+  "CMakeFiles/test-z3.dir/no_overflow.cpp.o"
+  "CMakeFiles/test-z3.dir/no_overflow.cpp.o.d"
+  "CMakeFiles/test-z3.dir/object_allocator.cpp.o"
+  "CMakeFiles/test-z3.dir/object_allocator.cpp.o.d"
+  "CMakeFiles/test-z3.dir/old_interval.cpp.o"
+  "CMakeFiles/test-z3.dir/old_interval.cpp.o.d"
+  "CMakeFiles/test-z3.dir/opt_parallel_cores.cpp.o"
+  "CMakeFiles/test-z3.dir/opt_parallel_cores.cpp.o.d"
+  "CMakeFiles/test-z3.dir/optional.cpp.o"
+  "CMakeFiles/test-z3.dir/optional.cpp.o.d"
+  "CMakeFiles/test-z3.dir/parallel_pool.cpp.o"
+  "CMakeFiles/test-z3.dir/parallel_pool.cpp.o.d"
+  "CMakeFiles/test-z3.dir/parallel_simplifier.cpp.o"
+  "CMakeFiles/test-z3.dir/parallel_simplifier.cpp.o.d"
+  "CMakeFiles/test-z3.dir/parray.cpp.o"
+  "CMakeFiles/test-z3.dir/parray.cpp.o.d"
+  "CMakeFiles/test-z3.dir/pb2bv.cpp.o"
+  "CMakeFiles/test-z3.dir/pb2bv.cpp.o.d"
+  "CMakeFiles/test-z3.dir/pdd.cpp.o"
+  "CMakeFiles/test-z3.dir/pdd.cpp.o.d"
+  "CMakeFiles/test-z3.dir/pdd_solver.cpp.o"
+  "CMakeFiles/test-z3.dir/pdd_solver.cpp.o.d"
+  "CMakeFiles/test-z3.dir/permutation.cpp.o"
+  "CMakeFiles/test-z3.dir/permutation.cpp.o.d"
+  "CMakeFiles/test-z3.dir/polynomial.cpp.o"
+  "CMakeFiles/test-z3.dir/polynomial.cpp.o.d"
+  "CMakeFiles/test-z3.dir/polynorm.cpp.o"
+  "CMakeFiles/test-z3.dir/polynorm.cpp.o.d"
+  "CMakeFiles/test-z3.dir/prime_generator.cpp.o"
+  "CMakeFiles/test-z3.dir/prime_generator.cpp.o.d"
+  "CMakeFiles/test-z3.dir/proof_checker.cpp.o"
+  "CMakeFiles/test-z3.dir/proof_checker.cpp.o.d"
+  "CMakeFiles/test-z3.dir/qe_arith.cpp.o"
+  "CMakeFiles/test-z3.dir/qe_arith.cpp.o.d"
+  "CMakeFiles/test-z3.dir/quant_elim.cpp.o"
+  "CMakeFiles/test-z3.dir/quant_elim.cpp.o.d"
+  "CMakeFiles/test-z3.dir/quant_solve.cpp.o"
+  "CMakeFiles/test-z3.dir/quant_solve.cpp.o.d"
+  "CMakeFiles/test-z3.dir/random.cpp.o"
+  "CMakeFiles/test-z3.dir/random.cpp.o.d"
+  "CMakeFiles/test-z3.dir/rational.cpp.o"
+  "CMakeFiles/test-z3.dir/rational.cpp.o.d"
+  "CMakeFiles/test-z3.dir/rcf.cpp.o"
+  "CMakeFiles/test-z3.dir/rcf.cpp.o.d"
+  "CMakeFiles/test-z3.dir/region.cpp.o"
+  "CMakeFiles/test-z3.dir/region.cpp.o.d"
+  "CMakeFiles/test-z3.dir/sat_circuit.cpp.o"
+  "CMakeFiles/test-z3.dir/sat_circuit.cpp.o.d"
+  "CMakeFiles/test-z3.dir/sat_local_search.cpp.o"
+  "CMakeFiles/test-z3.dir/sat_local_search.cpp.o.d"
+  "CMakeFiles/test-z3.dir/sat_lookahead.cpp.o"
+  "CMakeFiles/test-z3.dir/sat_lookahead.cpp.o.d"
+  "CMakeFiles/test-z3.dir/sat_user_scope.cpp.o"
+  "CMakeFiles/test-z3.dir/sat_user_scope.cpp.o.d"
+  "CMakeFiles/test-z3.dir/scoped_timer.cpp.o"
+  "CMakeFiles/test-z3.dir/scoped_timer.cpp.o.d"
+  "CMakeFiles/test-z3.dir/scoped_vector.cpp.o"
+  "CMakeFiles/test-z3.dir/scoped_vector.cpp.o.d"
+  "CMakeFiles/test-z3.dir/seq_dfa.cpp.o"
+  "CMakeFiles/test-z3.dir/seq_dfa.cpp.o.d"
+  "CMakeFiles/test-z3.dir/simple_parser.cpp.o"
+  "CMakeFiles/test-z3.dir/simple_parser.cpp.o.d"
+  "CMakeFiles/test-z3.dir/simplex.cpp.o"
+  "CMakeFiles/test-z3.dir/simplex.cpp.o.d"
+  "CMakeFiles/test-z3.dir/simplifier.cpp.o"
+  "CMakeFiles/test-z3.dir/simplifier.cpp.o.d"
+  "CMakeFiles/test-z3.dir/sls_seq_plugin.cpp.o"
+  "CMakeFiles/test-z3.dir/sls_seq_plugin.cpp.o.d"
+  "CMakeFiles/test-z3.dir/sls_test.cpp.o"
+  "CMakeFiles/test-z3.dir/sls_test.cpp.o.d"
+  "CMakeFiles/test-z3.dir/small_object_allocator.cpp.o"
+  "CMakeFiles/test-z3.dir/small_object_allocator.cpp.o.d"
+  "CMakeFiles/test-z3.dir/smt2print_parse.cpp.o"
+  "CMakeFiles/test-z3.dir/smt2print_parse.cpp.o.d"
+  "CMakeFiles/test-z3.dir/smt_context.cpp.o"
+  "CMakeFiles/test-z3.dir/smt_context.cpp.o.d"
+  "CMakeFiles/test-z3.dir/solver_pool.cpp.o"
+  "CMakeFiles/test-z3.dir/solver_pool.cpp.o.d"
+  "CMakeFiles/test-z3.dir/sorting_network.cpp.o"
+  "CMakeFiles/test-z3.dir/sorting_network.cpp.o.d"
+  "CMakeFiles/test-z3.dir/spacer_lemma.cpp.o"
+  "CMakeFiles/test-z3.dir/spacer_lemma.cpp.o.d"
+  "CMakeFiles/test-z3.dir/stack.cpp.o"
+  "CMakeFiles/test-z3.dir/stack.cpp.o.d"
+  "CMakeFiles/test-z3.dir/string_buffer.cpp.o"
+  "CMakeFiles/test-z3.dir/string_buffer.cpp.o.d"
+  "CMakeFiles/test-z3.dir/substitution.cpp.o"
+  "CMakeFiles/test-z3.dir/substitution.cpp.o.d"
+  "CMakeFiles/test-z3.dir/symbol.cpp.o"
+  "CMakeFiles/test-z3.dir/symbol.cpp.o.d"
+  "CMakeFiles/test-z3.dir/symbol_table.cpp.o"
+  "CMakeFiles/test-z3.dir/symbol_table.cpp.o.d"
+  "CMakeFiles/test-z3.dir/tbv.cpp.o"
+  "CMakeFiles/test-z3.dir/tbv.cpp.o.d"
+  "CMakeFiles/test-z3.dir/theory_dl.cpp.o"
+  "CMakeFiles/test-z3.dir/theory_dl.cpp.o.d"
+  "CMakeFiles/test-z3.dir/theory_pb.cpp.o"
+  "CMakeFiles/test-z3.dir/theory_pb.cpp.o.d"
+  "CMakeFiles/test-z3.dir/thread_cache_allocator.cpp.o"
+  "CMakeFiles/test-z3.dir/thread_cache_allocator.cpp.o.d"
+  "CMakeFiles/test-z3.dir/timeout.cpp.o"
+  "CMakeFiles/test-z3.dir/timeout.cpp.o.d"
+  "CMakeFiles/test-z3.dir/total_order.cpp.o"
+  "CMakeFiles/test-z3.dir/total_order.cpp.o.d"
+  "CMakeFiles/test-z3.dir/totalizer.cpp.o"
+  "CMakeFiles/test-z3.dir/totalizer.cpp.o.d"
+  "CMakeFiles/test-z3.dir/trigo.cpp.o"
+  "CMakeFiles/test-z3.dir/trigo.cpp.o.d"
+  "CMakeFiles/test-z3.dir/udoc_relation.cpp.o"
+  "CMakeFiles/test-z3.dir/udoc_relation.cpp.o.d"
+  "CMakeFiles/test-z3.dir/uint_set.cpp.o"
+  "CMakeFiles/test-z3.dir/uint_set.cpp.o.d"
+  "CMakeFiles/test-z3.dir/upolynomial.cpp.o"
+  "CMakeFiles/test-z3.dir/upolynomial.cpp.o.d"
+  "CMakeFiles/test-z3.dir/value_generator.cpp.o"
+  "CMakeFiles/test-z3.dir/value_generator.cpp.o.d"
+  "CMakeFiles/test-z3.dir/value_sweep.cpp.o"
+  "CMakeFiles/test-z3.dir/value_sweep.cpp.o.d"
+  "CMakeFiles/test-z3.dir/var_subst.cpp.o"
+  "CMakeFiles/test-z3.dir/var_subst.cpp.o.d"
+  "CMakeFiles/test-z3.dir/vector.cpp.o"
+  "CMakeFiles/test-z3.dir/vector.cpp.o.d"
+  "CMakeFiles/test-z3.dir/zstring.cpp.o"
+  "CMakeFiles/test-z3.dir/zstring.cpp.o.d"
+  "gparams_register_modules.cpp"
+  "install_tactic.cpp"
+  "mem_initializer.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test-z3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()